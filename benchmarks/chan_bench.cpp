@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <cmath>
+#include "chan_hull.h"
+#include "graham_hull.h"
+#include "quick_hull.h"
+
+// Chan's algorithm pays off when h is small compared to n: uniform points in a
+// square have O(log n) hull vertices. Points on a circle (h = n) show the other end.
+
+static std::vector<Point> uniformSquare(size_t n) {
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    return pts;
+}
+
+static std::vector<Point> onCircle(size_t n) {
+    std::mt19937_64 rng(2);
+    std::uniform_real_distribution<double> angle(0.0, 2 * M_PI);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) {
+        double a = angle(rng);
+        p = {std::cos(a), std::sin(a)};
+    }
+    return pts;
+}
+
+template <std::vector<Point> (*Engine)(std::vector<Point>),
+          std::vector<Point> (*Input)(size_t)>
+static void BM_Hull(benchmark::State& state) {
+    auto pts = Input(state.range(0));
+    size_t h = 0;
+    for (auto _ : state) {
+        auto hull = Engine(pts);
+        h = hull.size();
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.counters["hull"] = h;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_Hull, chanHull, uniformSquare)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_Hull, grahamHull, uniformSquare)->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_Hull, quickHull, uniformSquare)->RangeMultiplier(10)->Range(1000, 10000000);
+
+BENCHMARK_TEMPLATE(BM_Hull, chanHull, onCircle)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Hull, grahamHull, onCircle)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK_TEMPLATE(BM_Hull, quickHull, onCircle)->RangeMultiplier(10)->Range(1000, 1000000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+#include "dynamic_hull.h"
+#include "graham_hull.h"
+
+// Mixed insert/erase workloads on a live set of n points: every iteration applies one
+// update and then needs the current hull. DynamicHull2D updates in place; the baseline
+// recomputes grahamHull over the whole set. Arg(1) is the share of erases in percent.
+
+struct Workload {
+    std::vector<Point> live;
+    std::mt19937_64 rng{3};
+    std::normal_distribution<double> coord{0.0, 1.0};
+
+    explicit Workload(size_t n) {
+        live.resize(n);
+        for (auto& p : live) p = {coord(rng), coord(rng)};
+    }
+    Point fresh() { return {coord(rng), coord(rng)}; }
+};
+
+static void BM_DynamicHull(benchmark::State& state) {
+    Workload w(state.range(0));
+    const unsigned erasePct = state.range(1);
+    DynamicHull2D dyn;
+    for (auto& p : w.live) dyn.insert(p);
+
+    for (auto _ : state) {
+        if (w.rng() % 100 < erasePct) {
+            // erase a random live point and insert a fresh one so n stays put
+            size_t i = w.rng() % w.live.size();
+            dyn.erase(w.live[i]);
+            w.live[i] = w.fresh();
+            dyn.insert(w.live[i]);
+        } else {
+            w.live.push_back(w.fresh());
+            dyn.insert(w.live.back());
+        }
+        auto hull = dyn.hull();
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Recompute(benchmark::State& state) {
+    Workload w(state.range(0));
+    const unsigned erasePct = state.range(1);
+
+    for (auto _ : state) {
+        if (w.rng() % 100 < erasePct) {
+            size_t i = w.rng() % w.live.size();
+            w.live[i] = w.fresh();
+        } else {
+            w.live.push_back(w.fresh());
+        }
+        auto hull = grahamHull(w.live);
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DynamicHull)->ArgsProduct({{1000, 100000, 1000000}, {10, 50, 90}});
+BENCHMARK(BM_Recompute)->ArgsProduct({{1000, 100000}, {10, 50, 90}});
+
+BENCHMARK_MAIN();
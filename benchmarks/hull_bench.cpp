@@ -0,0 +1,232 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <cmath>
+#include <vector>
+#include "graham_hull.h"
+#include "quick_hull.h"
+#include "quick_hull_3d.h"
+#include "point_soa.h"
+
+// Every engine on every input distribution, n = 1e2 .. 1e8. Reported per run:
+//   items_per_second - input points per second
+//   hull             - hull size (vertices in 2D, faces in 3D)
+// Distributions span the expected hull sizes engines care about: O(log n) for the
+// uniform square (O(log^2 n) cube), O(n^1/3) for the disk (O(n^1/2) ball), O(sqrt(log n))
+// for the Gaussian, and h = n for points on a circle or sphere. h = n inputs stop earlier
+// since every engine does far more work per point there. Inputs are seeded, so runs are
+// comparable.
+
+using qh3d::Vec3;
+
+// ---- 2D inputs ----
+
+static std::vector<Point> uniformSquare(size_t n) {
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    return pts;
+}
+
+static std::vector<Point> uniformDisk(size_t n) {
+    std::mt19937_64 rng(2);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) {
+        double r = std::sqrt(unit(rng)), a = 2 * M_PI * unit(rng);
+        p = {r * std::cos(a), r * std::sin(a)};
+    }
+    return pts;
+}
+
+static std::vector<Point> onCircle(size_t n) {
+    std::mt19937_64 rng(3);
+    std::uniform_real_distribution<double> angle(0.0, 2 * M_PI);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) {
+        double a = angle(rng);
+        p = {std::cos(a), std::sin(a)};
+    }
+    return pts;
+}
+
+static std::vector<Point> gaussian(size_t n) {
+    std::mt19937_64 rng(4);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    return pts;
+}
+
+// 16 tight Gaussian blobs scattered over the unit square
+static std::vector<Point> clustered(size_t n) {
+    std::mt19937_64 rng(5);
+    std::uniform_real_distribution<double> center(-1.0, 1.0);
+    std::normal_distribution<double> spread(0.0, 0.02);
+    std::vector<Point> centers(16);
+    for (auto& c : centers) c = {center(rng), center(rng)};
+    std::vector<Point> pts(n);
+    for (size_t i = 0; i < n; i++) {
+        const Point& c = centers[rng() % centers.size()];
+        pts[i] = {c.x + spread(rng), c.y + spread(rng)};
+    }
+    return pts;
+}
+
+// ---- 3D inputs ----
+
+static std::vector<Vec3> uniformCube(size_t n) {
+    std::mt19937_64 rng(6);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Vec3> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng), coord(rng)};
+    return pts;
+}
+
+static std::vector<Vec3> uniformBall(size_t n) {
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Vec3> pts;
+    pts.reserve(n);
+    while (pts.size() < n) {
+        Vec3 p{coord(rng), coord(rng), coord(rng)};
+        if (qh3d::dot(p, p) <= 1.0) pts.push_back(p);
+    }
+    return pts;
+}
+
+static std::vector<Vec3> onSphere(size_t n) {
+    std::mt19937_64 rng(8);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Vec3> pts(n);
+    for (auto& p : pts) {
+        Vec3 d{coord(rng), coord(rng), coord(rng)};
+        p = d * (1.0 / qh3d::norm(d));
+    }
+    return pts;
+}
+
+static std::vector<Vec3> gaussian3D(size_t n) {
+    std::mt19937_64 rng(9);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Vec3> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng), coord(rng)};
+    return pts;
+}
+
+static std::vector<Vec3> clustered3D(size_t n) {
+    std::mt19937_64 rng(10);
+    std::uniform_real_distribution<double> center(-1.0, 1.0);
+    std::normal_distribution<double> spread(0.0, 0.02);
+    std::vector<Vec3> centers(16);
+    for (auto& c : centers) c = {center(rng), center(rng), center(rng)};
+    std::vector<Vec3> pts(n);
+    for (size_t i = 0; i < n; i++) {
+        const Vec3& c = centers[rng() % centers.size()];
+        pts[i] = {c.x + spread(rng), c.y + spread(rng), c.z + spread(rng)};
+    }
+    return pts;
+}
+
+// ---- Runners ----
+
+template <std::vector<Point> (*Engine)(std::vector<Point>),
+          std::vector<Point> (*Input)(size_t)>
+static void BM_Hull2D(benchmark::State& state) {
+    auto pts = Input(state.range(0));
+    size_t h = 0;
+    for (auto _ : state) {
+        auto hull = Engine(pts);
+        h = hull.size();
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.counters["hull"] = h;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Exact = true runs with eps = 0 (exact orient3d visibility)
+template <bool Exact, std::vector<Vec3> (*Input)(size_t)>
+static void BM_Hull3D(benchmark::State& state) {
+    auto pts = Input(state.range(0));
+    size_t h = 0;
+    for (auto _ : state) {
+        auto faces = qh3d::convex_hull_3d(pts, Exact ? 0.0 : 1e-9);
+        h = faces.size();
+        benchmark::DoNotOptimize(faces.data());
+    }
+    state.counters["hull"] = h;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// quickHullParallel against its thread count (range(1)), in wall-clock time: the
+// speedup curve of the pool
+static void BM_QuickHullParallel(benchmark::State& state) {
+    auto pts = uniformDisk(state.range(0));
+    size_t h = 0;
+    for (auto _ : state) {
+        auto hull = quickHullParallel(pts, 1 << 15, (unsigned)state.range(1));
+        h = hull.size();
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.counters["hull"] = h;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// quickHullSoA on input already in SoA layout; Reuse = true keeps one scratch across
+// iterations, so the working buffers are not faulted in again every run
+template <bool Reuse, std::vector<Point> (*Input)(size_t)>
+static void BM_QuickHullSoA(benchmark::State& state) {
+    PointsSoA pts(Input(state.range(0))), scratch;
+    size_t h = 0;
+    for (auto _ : state) {
+        auto hull = Reuse ? quickHullSoA(pts, scratch) : quickHullSoA(pts);
+        h = hull.size();
+        benchmark::DoNotOptimize(hull.data());
+    }
+    state.counters["hull"] = h;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define HULL_2D(engine, input, maxN) \
+    BENCHMARK_TEMPLATE(BM_Hull2D, engine, input) \
+        ->RangeMultiplier(10)->Range(100, maxN)->Unit(benchmark::kMillisecond)
+#define HULL_3D(exact, input, maxN) \
+    BENCHMARK_TEMPLATE(BM_Hull3D, exact, input) \
+        ->RangeMultiplier(10)->Range(100, maxN)->Unit(benchmark::kMillisecond)
+#define HULL_SOA(reuse, input, maxN) \
+    BENCHMARK_TEMPLATE(BM_QuickHullSoA, reuse, input) \
+        ->RangeMultiplier(10)->Range(100, maxN)->Unit(benchmark::kMillisecond)
+
+HULL_2D(quickHull, uniformSquare, 100000000);
+HULL_2D(grahamHull, uniformSquare, 100000000);
+HULL_2D(quickHull, uniformDisk, 100000000);
+HULL_2D(grahamHull, uniformDisk, 100000000);
+HULL_2D(quickHull, gaussian, 100000000);
+HULL_2D(grahamHull, gaussian, 100000000);
+HULL_2D(quickHull, clustered, 100000000);
+HULL_2D(grahamHull, clustered, 100000000);
+HULL_2D(quickHull, onCircle, 10000000);
+HULL_2D(grahamHull, onCircle, 10000000);
+
+HULL_SOA(false, uniformSquare, 100000000);
+HULL_SOA(true, uniformSquare, 100000000);
+HULL_SOA(false, uniformDisk, 100000000);
+HULL_SOA(true, uniformDisk, 100000000);
+
+BENCHMARK(BM_QuickHullParallel)->Apply([](benchmark::internal::Benchmark* b) {
+    for (long n : {1000000, 10000000})
+        for (long threads : {1, 2, 4, 8, 16}) b->Args({n, threads});
+})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+HULL_3D(false, uniformCube, 100000000);
+HULL_3D(true, uniformCube, 100000000);
+HULL_3D(false, uniformBall, 10000000);
+HULL_3D(true, uniformBall, 10000000);
+HULL_3D(false, gaussian3D, 100000000);
+HULL_3D(true, gaussian3D, 100000000);
+HULL_3D(false, clustered3D, 100000000);
+HULL_3D(true, clustered3D, 100000000);
+HULL_3D(false, onSphere, 1000000);
+HULL_3D(true, onSphere, 1000000);
+
+BENCHMARK_MAIN();
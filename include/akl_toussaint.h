@@ -0,0 +1,32 @@
+#ifndef AKL_TOUSSAINT_H
+#define AKL_TOUSSAINT_H
+
+#include <vector>
+#include <cstddef>
+#include "point.h"
+#include "predicates.h"
+#include "point_view.h"
+
+// Akl–Toussaint heuristic: the extreme points in x, y, x+y and x-y span a convex
+// polygon (up to an octagon) that lies inside the hull. Every point strictly inside
+// that polygon can't be a hull vertex, so it's removed before the real engine runs.
+// Works in place in O(n) and returns the number of removed points.
+size_t aklToussaintFilter(std::vector<Point>& pts);
+
+// The filter's building blocks, for callers that keep their points elsewhere:
+// writes the distinct extreme points of pts[0, n) to poly in counter-clockwise order
+// and returns how many there are, or 0 when fewer than 3 make nothing filterable.
+size_t aklToussaintPolygon(const PointView& pts, Point poly[8]);
+inline size_t aklToussaintPolygon(const Point* pts, size_t n, Point poly[8]) {
+    return aklToussaintPolygon(pointSpan(pts, n), poly);
+}
+
+// Is p strictly inside the m-gon returned by aklToussaintPolygon?
+inline bool aklToussaintInside(const Point poly[8], size_t m, const Point& p) {
+    for (size_t i = 0; i < m; i++) {
+        if (orientation(poly[i], poly[(i + 1) % m], p) <= 0) return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef BATCH_HULL_H
+#define BATCH_HULL_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "point.h"
+
+// Hulls of many small point groups, in compressed sparse row form: the hull of group g
+// is indices[offsets[g] .. offsets[g+1]), positions into the flat input array, in the
+// same counter-clockwise order grahamHull returns the points.
+struct HullBatch {
+    std::vector<uint32_t> offsets;      // groups + 1 entries
+    std::vector<uint32_t> indices;
+};
+
+// Group g is points[groupOffsets[g] .. groupOffsets[g+1]). Groups are spread over
+// `threads` workers (0 = every core; small batches run serially). Each worker sorts
+// and scans in its own reused buffers, so the only allocations are per worker and
+// for the result, never per group.
+HullBatch batchHulls(const std::vector<Point>& points, const std::vector<uint32_t>& groupOffsets,
+                     unsigned threads = 0);
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef CHAN_HULL_H
+#define CHAN_HULL_H
+
+#include <vector>
+#include <cstddef>
+#include "point.h"
+
+// Index of the vertex of convex polygon `poly` (CCW, as returned by grahamHull) that a
+// Jarvis march standing at p would wrap to next: every vertex is on the left of, or on,
+// the ray p->result, and collinear ties go to the farthest one. Binary search, O(log m).
+size_t chanTangent(const std::vector<Point>& poly, const Point& p);
+
+// Chan's output-sensitive Convex Hull, O(n log h):
+// guess h as m = 2^(2^t), build mini-hulls of m points each with grahamHull, then run at
+// most m Jarvis-march steps that pick the next vertex among the mini-hull tangents.
+// If the march doesn't close, square m and retry. Same output as grahamHull.
+std::vector<Point> chanHull(std::vector<Point> points);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef DYNAMIC_HULL_H
+#define DYNAMIC_HULL_H
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include "point.h"
+
+// Fully dynamic 2D Convex Hull (Overmars–van Leeuwen style): points can be inserted
+// and erased in any order without recomputing the hull from scratch.
+// The points live in the leaves of a weight-balanced tree, sorted by x then y. Every
+// inner node stores only the two bridges (upper and lower) joining the hulls of its
+// subtrees; those hulls are never materialized but walked implicitly through the
+// children's bridges. An update recomputes the bridges along one root path, each with
+// a nested O(log^2 n) descent, so updates take O(log^3 n); the hull is read out in
+// O(h log n). Side tests use the exact predicates of predicates.h.
+class DynamicHull2D {
+public:
+    DynamicHull2D();
+    ~DynamicHull2D();
+    DynamicHull2D(DynamicHull2D&&) noexcept;
+    DynamicHull2D& operator=(DynamicHull2D&&) noexcept;
+
+    // Add p. Repeated points are counted and have to be erased as often.
+    void insert(const Point& p);
+
+    // Remove one copy of p. Returns false when p isn't in the set.
+    bool erase(const Point& p);
+
+    // Current hull, identical to grahamHull on the points in the set
+    // (except that repeated copies of a single point give just that point).
+    std::vector<Point> hull() const;
+
+    // Number of points in the set, repeated copies included
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    void clear();
+
+    struct Node;    // tree node, defined in dynamic_hull.cpp
+
+private:
+    std::unique_ptr<Node> root;
+    size_t count = 0;
+};
+
+#endif
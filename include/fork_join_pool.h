@@ -0,0 +1,71 @@
+#ifndef FORK_JOIN_POOL_H
+#define FORK_JOIN_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <cstddef>
+
+// Fixed set of threads for one parallel computation. Tasks forked anywhere, at any
+// nesting depth, share these threads, so recursive fork-join never runs more threads
+// than the pool was built with. join() runs queued tasks on the joining thread until
+// its own group is done: a thread waiting on its children keeps working instead of
+// blocking, which also makes nested joins deadlock-free.
+class ForkJoinPool {
+public:
+    // `threads` in total, the calling thread included (0: one per core)
+    explicit ForkJoinPool(unsigned threads = 0);
+    ~ForkJoinPool();
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    unsigned size() const { return (unsigned)workers.size() + 1; }
+
+    // The tasks forked into one group; join(group) waits for exactly those
+    class Group {
+        friend class ForkJoinPool;
+        size_t pending = 0;
+        std::exception_ptr error;
+    };
+
+    void fork(Group& group, std::function<void()> task);
+    // Returns once every task of the group has run; rethrows the first one's exception
+    void join(Group& group);
+
+    // fn(i) for every i in [0, count): fn(0) on the calling thread, the rest forked
+    template <class Fn>
+    void parallelFor(size_t count, Fn fn) {
+        Group group;
+        for (size_t i = 1; i < count; i++) fork(group, [&fn, i] { fn(i); });
+        try {
+            if (count > 0) fn(0);
+        } catch (...) {
+            join(group);
+            throw;
+        }
+        join(group);
+    }
+
+private:
+    struct Task {
+        std::function<void()> run;
+        Group* group;
+    };
+
+    // run a task taken off the queue, then retire it from its group (lock held on entry
+    // and on return)
+    void execute(Task task, std::unique_lock<std::mutex>& lock);
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<Task> queue;     // newest last: popping from the back stays depth-first
+    bool stopping = false;
+};
+
+#endif
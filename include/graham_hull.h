@@ -5,14 +5,49 @@
 #include <algorithm>
 #include <stack>
 #include <cmath>
+#include <cstdint>
 #include "draw.h"
 #include "point.h"
+#include "point_view.h"
 
 
 // Graham Scan Convex Hull, using cross product and its rotation feature
 // feature (counter-clockwise :: positive) to collect all right furthest points
 // while iterate along X axis forwards and backwards: lower part and upper part 
-std::vector<Point> grahamHull(std::vector<Point> points);
+// Instantiated for float, double and int64_t coordinates (see CoordTraits in point.h).
+template <typename T>
+std::vector<BasicPoint<T>> grahamHull(std::vector<BasicPoint<T>> points);
+
+// Graham Scan with an optional Akl–Toussaint prefilter stage in front of the sort.
+// When `removed` is given it receives the number of points the prefilter threw away.
+std::vector<Point> grahamHull(std::vector<Point> points, bool prefilter, size_t* removed = nullptr);
+
+// Buffers for grahamHull over a view, kept by the caller and reused across calls: the
+// points that survive the prefilter, and the radix sort's ping-pong buffer
+struct GrahamScratch {
+    std::vector<Point> points;
+    std::vector<Point> sort;
+};
+
+// Graham Scan reading straight from caller memory (see point_view.h). Only the points
+// outside the Akl–Toussaint polygon are copied, into `scratch`, and sorted there.
+// Writes up to `capacity` hull vertices to `out` and returns the hull size, so a return
+// value above capacity means the buffer was too small.
+// Same vertices, in the same order, as grahamHull.
+size_t grahamHull(const PointView& in, Point* out, size_t capacity, GrahamScratch& scratch);
+
+// Graham Scan returning positions into `in` instead of point copies, in the same
+// counter-clockwise order as grahamHull. Throws std::length_error for 2^32 or more points.
+std::vector<uint32_t> grahamHullIndices(const PointView& in);
+
+// Parallel Graham Scan: parallel sample sort into contiguous x-slabs, one monotone
+// chain per slab, then pairwise merges of neighbouring slab hulls in O(h) each, all on
+// one ForkJoinPool (fork_join_pool.h). Holds a second copy of the points only while
+// scattering and sorting the slabs; each slab's sort uses its share of it as scratch.
+// `threads` = 0 uses every core; inputs under `cutoff` points per thread run serially.
+// Output is identical to grahamHull.
+std::vector<Point> grahamHullParallel(std::vector<Point> points, unsigned threads = 0,
+                                      size_t cutoff = 1 << 15);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef INCREMENTAL_HULL_H
+#define INCREMENTAL_HULL_H
+
+#include <vector>
+#include <set>
+#include <cstddef>
+#include "point.h"
+
+// Online 2D Convex Hull: points arrive one at a time, the hull is kept up to date in
+// O(log h) per insert (amortized, counting the vertices an insert removes) and never
+// rebuilt. Interior points are rejected with two O(log h) lookups and no allocation.
+// Side tests use the exact predicates of predicates.h.
+class IncrementalHull2D {
+public:
+    // Add p. Returns true when the hull changed, false when p lies inside or on it.
+    bool insert(const Point& p);
+
+    // Is p inside or on the boundary of the current hull?
+    bool contains(const Point& p) const;
+
+    // Current hull, identical to grahamHull on every point inserted so far
+    // (except that repeated copies of a single point give just that point).
+    std::vector<Point> hull() const;
+
+    // Number of hull vertices
+    size_t size() const;
+    bool empty() const { return lower.pts.empty(); }
+    void clear();
+
+private:
+    struct LexLess {
+        bool operator()(const Point& a, const Point& b) const {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        }
+    };
+
+    // Lower convex chain in lexicographic (x, then y) order, the same chain the
+    // monotone scan in grahamHull builds: every inner vertex is a strict left turn.
+    struct Chain {
+        std::set<Point, LexLess> pts;
+        bool covers(const Point& p) const;  // p can't change the chain
+        bool insert(const Point& p);
+    };
+
+    // The upper chain is the lower chain of the points rotated by 180° (x, y) -> (-x, -y),
+    // so both use the same code; read in order it runs from the right end to the left one.
+    Chain lower, upper;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef MONOTONE_CHAIN_H
+#define MONOTONE_CHAIN_H
+
+#include <vector>
+#include <cstddef>
+#include "predicates.h"
+
+// Andrew's monotone chain over at least 2 elements sorted by x, then y, of their
+// points. pos(e) gives the point of element e, so the same scan runs on points, on
+// indices into a view and on tagged points. Writes the counter-clockwise hull,
+// starting at the first element, to `hull`; keeping `hull` around across calls
+// reuses its buffer.
+template <class Elem, class Pos>
+void monotoneChain(const std::vector<Elem>& points, Pos pos, std::vector<Elem>& hull) {
+    // signed, for the downward loop; wide enough for every index a caller can pass
+    const std::ptrdiff_t n = points.size();
+    hull.resize(2 * (size_t)n);
+    std::ptrdiff_t k = 0;
+
+    // Build lower hull
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        while (k >= 2 && orientation(pos(hull[k-2]), pos(hull[k-1]), pos(points[i])) <= 0) k--;
+        hull[k++] = points[i];
+    }
+
+    // Build upper hull
+    for (std::ptrdiff_t i = n-2, t = k+1; i >= 0; --i) {
+        while (k >= t && orientation(pos(hull[k-2]), pos(hull[k-1]), pos(points[i])) <= 0) k--;
+        hull[k++] = points[i];
+    }
+
+    hull.resize(k-1);
+}
+
+template <class Elem, class Pos>
+std::vector<Elem> monotoneChain(const std::vector<Elem>& points, Pos pos) {
+    std::vector<Elem> hull;
+    monotoneChain(points, pos, hull);
+    return hull;
+}
+
+#endif
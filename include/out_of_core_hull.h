@@ -0,0 +1,20 @@
+#ifndef OUT_OF_CORE_HULL_H
+#define OUT_OF_CORE_HULL_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "point.h"
+
+// Out-of-core 2D hull of a point file (see point_file.h) that need not fit in memory.
+// A reader thread streams `chunkPoints` records at a time into one of two buffers
+// while the calling thread reduces the other one to its hull (grahamHull), so disk
+// reads overlap hull work. Chunk hulls are collected and re-hulled whenever they pile
+// up, so memory stays at two chunks plus the hull vertices seen so far.
+// Same vertices, in the same order, as grahamHull over the whole file. Throws
+// std::runtime_error on I/O errors, malformed files and 3D files.
+// `chunks`, when given, receives the number of chunks read.
+std::vector<Point> outOfCoreHull(const std::string& path, size_t chunkPoints = 1 << 22,
+                                 size_t* chunks = nullptr);
+
+#endif
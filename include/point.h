@@ -3,35 +3,91 @@
 
 #include <vector>
 #include <cmath>
+#include <cstdint>
 #include <algorithm>
 
 // EPS tolerance for floating-point comparisons
-const double EPS = 1e-9;
+constexpr double EPS = 1e-9;
 
-struct Point {
-    double x, y;
-    bool operator==(const Point& other) const {
-        return std::fabs(x - other.x) < EPS &&
-               std::fabs(y - other.y) < EPS;
+// ===== Coordinate kernels =====
+// Compile-time traits for each supported coordinate type:
+//  - area_type: type cross products are evaluated in
+//  - exact:     cross products are exact, so predicates need no tolerance
+//  - eps:       tolerance of the inexact kernels (0 for exact ones)
+template <typename T> struct CoordTraits;
+
+template <> struct CoordTraits<float> {
+    using area_type = float;                 // stays in float: twice the SIMD width of double
+    static constexpr bool exact = false;
+    static constexpr float eps = 1e-5f;
+};
+
+template <> struct CoordTraits<double> {
+    using area_type = double;
+    static constexpr bool exact = false;
+    static constexpr double eps = EPS;
+};
+
+// Integer pixel/tile coordinates: differences and products are evaluated in 128 bits,
+// so cross products are exact for any coordinates that fit in 62 bits.
+template <> struct CoordTraits<int64_t> {
+    using area_type = __int128;
+    static constexpr bool exact = true;
+    static constexpr int64_t eps = 0;
+};
+
+template <typename T>
+struct BasicPoint {
+    T x, y;
+    bool operator==(const BasicPoint& other) const {
+        if constexpr (CoordTraits<T>::exact) {
+            return x == other.x && y == other.y;
+        } else {
+            return std::fabs(x - other.x) < CoordTraits<T>::eps &&
+                   std::fabs(y - other.y) < CoordTraits<T>::eps;
+        }
     }
 };
 
+using Point = BasicPoint<double>;
+using PointF = BasicPoint<float>;
+using PointI = BasicPoint<int64_t>;
+
 // Compute cross product of OA × OB
-inline double cross(const Point& O, const Point& A, const Point& B) {
-    return (A.x - O.x) * (B.y - O.y) - (A.y - O.y) * (B.x - O.x);
+template <typename T>
+inline typename CoordTraits<T>::area_type
+cross(const BasicPoint<T>& O, const BasicPoint<T>& A, const BasicPoint<T>& B) {
+    using R = typename CoordTraits<T>::area_type;
+    return (R(A.x) - R(O.x)) * (R(B.y) - R(O.y)) - (R(A.y) - R(O.y)) * (R(B.x) - R(O.x));
 }
 
 // Distance from point P to line AB
-inline double distance(const Point& A, const Point& B, const Point& P) {
-    double area = std::fabs(cross(A, B, P));
-    double base = std::hypot(B.x - A.x, B.y - A.y);
+template <typename T>
+inline double distance(const BasicPoint<T>& A, const BasicPoint<T>& B, const BasicPoint<T>& P) {
+    double area = std::fabs((double)cross(A, B, P));
+    double base = std::hypot((double)B.x - (double)A.x, (double)B.y - (double)A.y);
     return area / (base + EPS);     // add EPS to avoid div/0
 }
 
+// Smallest cross(A, B, P) for which distance(A, B, P) > eps. Hot loops that only
+// compare distances to one edge test the raw cross product against this instead.
+// Exact kernels have no tolerance: any positive cross product counts.
+template <typename T>
+inline typename CoordTraits<T>::area_type
+minCrossForEdge(const BasicPoint<T>& A, const BasicPoint<T>& B) {
+    using R = typename CoordTraits<T>::area_type;
+    if constexpr (CoordTraits<T>::exact) {
+        return R(0);
+    } else {
+        constexpr R eps = CoordTraits<T>::eps;
+        return eps * (std::hypot(B.x - A.x, B.y - A.y) + eps);
+    }
+}
+
 // double x1 = 0.1 + 0.2;  // 0.3 expected, but it's not
 // x1 == 0.3 => false, so we need define "almostEqual" func
 inline bool almostEqual(double a, double b, double eps = 1e-6) {
     return std::abs(a - b) < eps;
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,86 @@
+#ifndef POINT_FILE_H
+#define POINT_FILE_H
+
+#include <vector>
+#include <array>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "point.h"
+#include "point_view.h"
+#include "quick_hull_3d.h"
+
+// ===== Binary point files =====
+// A 32-byte little-endian header followed by `count` interleaved records of `dim`
+// coordinates each (x y or x y z), all float or all double:
+//
+//   offset  0  char[4]   magic "CHPT"
+//   offset  4  uint16    version (1)
+//   offset  6  uint8     dim: 2 or 3
+//   offset  7  uint8     scalar size in bytes: 4 (float) or 8 (double)
+//   offset  8  uint64    count
+//   offset 16  uint64    byte offset of the first record (>= 32, multiple of 8)
+//   offset 24  uint64    reserved, 0
+struct PointFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint8_t dim;
+    uint8_t scalarBytes;
+    uint64_t count;
+    uint64_t dataOffset;
+    uint64_t reserved;
+};
+static_assert(sizeof(PointFileHeader) == 32, "point file header must stay 32 bytes");
+
+// Throw std::runtime_error unless `header` is a supported point file header whose
+// records fit in a file of `fileSize` bytes
+void checkPointFileHeader(const PointFileHeader& header, uint64_t fileSize, const std::string& path);
+
+// Read-only memory mapping of a point file. Double files are exposed as views straight
+// over the mapped pages, so nothing is copied or parsed; float files are widened to
+// double once, on the first call to view2D() / view3D(). Throws std::runtime_error on
+// I/O errors and malformed headers. Move-only; unmaps on destruction.
+class MappedPointFile {
+public:
+    explicit MappedPointFile(const std::string& path);
+    ~MappedPointFile();
+    MappedPointFile(MappedPointFile&& other) noexcept;
+    MappedPointFile& operator=(MappedPointFile&& other) noexcept;
+    MappedPointFile(const MappedPointFile&) = delete;
+    MappedPointFile& operator=(const MappedPointFile&) = delete;
+
+    int dim() const { return header.dim; }
+    int scalarBytes() const { return header.scalarBytes; }
+    size_t size() const { return header.count; }
+
+    // Throw unless dim() is 2 (resp. 3)
+    PointView view2D();
+    qh3d::PointView3D view3D();
+
+private:
+    const char* records() const { return static_cast<const char*>(base) + header.dataOffset; }
+    void widen();
+    void release();
+
+    void* base = nullptr;
+    size_t length = 0;
+    PointFileHeader header{};
+    std::vector<double> widened;    // float files only: coordinates as double, interleaved
+};
+
+// Write `count` records of `dim` coordinates from `coords` (interleaved, `scalarBytes`
+// wide each) as a point file. Throws std::runtime_error on I/O errors.
+void writePointFile(const std::string& path, int dim, int scalarBytes, const void* coords, size_t count);
+
+inline void writePointFile(const std::string& path, const std::vector<Point>& pts) {
+    writePointFile(path, 2, sizeof(double), pts.data(), pts.size());
+}
+inline void writePointFile(const std::string& path, const std::vector<qh3d::Vec3>& pts) {
+    writePointFile(path, 3, sizeof(double), pts.data(), pts.size());
+}
+
+// Raw little-endian uint32 arrays, for hull indices (one per vertex in 2D, three per
+// face in 3D)
+void writeIndexFile(const std::string& path, const uint32_t* indices, size_t count);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef POINT_SOA_H
+#define POINT_SOA_H
+
+#include <vector>
+#include <cstddef>
+#include "point.h"
+
+// Structure-of-arrays point storage for the 2D engines: x and y live in separate
+// contiguous arrays so the scan kernels below can load 4 (AVX2) or 8 (AVX-512)
+// coordinates at once.
+struct PointsSoA {
+    std::vector<double> x, y;
+
+    PointsSoA() = default;
+    explicit PointsSoA(const std::vector<Point>& pts);
+
+    size_t size() const { return x.size(); }
+    void resize(size_t n) { x.resize(n); y.resize(n); }
+    void push_back(const Point& p) { x.push_back(p.x); y.push_back(p.y); }
+    Point operator[](size_t i) const { return {x[i], y[i]}; }
+};
+
+// ===== Scan kernels =====
+// All kernels work on raw cross products (twice the signed area of A, B, p). Only
+// the ordering matters, so nothing is divided by |AB|.
+// Every build carries scalar, AVX2 and AVX-512 versions of each kernel (x86 with GCC or
+// Clang); the widest one the CPU supports is used unless setSoaKernelIsa says otherwise.
+// All versions return the same results.
+
+enum class SoaKernelIsa { Scalar, AVX2, AVX512 };
+
+SoaKernelIsa soaKernelIsa();
+
+// Run the kernels with `isa` from now on, e.g. to test or time each version. Returns
+// false, and changes nothing, when the CPU (or the build) does not support it.
+bool setSoaKernelIsa(SoaKernelIsa isa);
+
+// Leftmost and rightmost of n > 0 points, as std::minmax_element on x picks them:
+// the first smallest x and the last largest x.
+void soaExtremesX(const double* x, size_t n, size_t& iMin, size_t& iMax);
+
+// Index of the first point with the largest cross(A, B, p) strictly above minArea,
+// or n if there is none.
+size_t soaFarthestFromEdge(const double* x, const double* y, size_t n,
+                           const Point& A, const Point& B, double minArea);
+
+// Split n points into the two outside sets of edges (A1,B1) and (A2,B2):
+// points with cross(A1, B1, p) > min1 are written to the front of (ox, oy) and
+// points with cross(A2, B2, p) > min2 to its back; everything else is dropped.
+// The output arrays must hold n entries. The two sets must be disjoint.
+void soaSplitOutside(const double* x, const double* y, size_t n,
+                     const Point& A1, const Point& B1, double min1,
+                     const Point& A2, const Point& B2, double min2,
+                     double* ox, double* oy, size_t& nFront, size_t& nBack);
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef POINT_VIEW_H
+#define POINT_VIEW_H
+
+#include <vector>
+#include <cstddef>
+#include "point.h"
+#include "point_soa.h"
+
+// Non-owning view over 2D points that live in the caller's memory: a pointer to the
+// first x and the first y plus the byte distance between consecutive points. The same
+// type covers contiguous Point arrays, x/y fields inside larger records (AoS with any
+// stride) and separate x[] / y[] columns (SoA). The data must outlive the view.
+struct PointView {
+    const double* x = nullptr;
+    const double* y = nullptr;
+    size_t n = 0;
+    size_t stride = sizeof(double);     // bytes from one point's x (or y) to the next
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+
+    Point operator[](size_t i) const {
+        return {*reinterpret_cast<const double*>(reinterpret_cast<const char*>(x) + i * stride),
+                *reinterpret_cast<const double*>(reinterpret_cast<const char*>(y) + i * stride)};
+    }
+};
+
+// Contiguous Point array
+inline PointView pointSpan(const Point* pts, size_t n) {
+    const char* base = reinterpret_cast<const char*>(pts);
+    return {reinterpret_cast<const double*>(base + offsetof(Point, x)),
+            reinterpret_cast<const double*>(base + offsetof(Point, y)), n, sizeof(Point)};
+}
+inline PointView pointSpan(const std::vector<Point>& pts) {
+    return pointSpan(pts.data(), pts.size());
+}
+
+// x and y fields of records `stride` bytes apart, e.g.
+// pointStrided(&recs[0].pos_x, &recs[0].pos_y, recs.size(), sizeof(Record))
+inline PointView pointStrided(const double* x, const double* y, size_t n, size_t stride) {
+    return {x, y, n, stride};
+}
+
+// Separate coordinate columns
+inline PointView pointColumns(const double* x, const double* y, size_t n) {
+    return {x, y, n, sizeof(double)};
+}
+inline PointView pointColumns(const PointsSoA& pts) {
+    return pointColumns(pts.x.data(), pts.y.data(), pts.size());
+}
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef PREDICATES_H
+#define PREDICATES_H
+
+#include <cmath>
+#include "point.h"
+
+// ===== Filtered exact orientation predicates =====
+// Each predicate first evaluates the determinant in plain floating point together with
+// a static error bound (Shewchuk's A-bounds). Only when |det| is below the bound, i.e.
+// the sign is uncertain, is the determinant re-evaluated exactly with floating-point
+// expansions (predicates.cpp). The sign of the result is always exact; its magnitude
+// is approximate. The fast paths are inline so hot loops pay for a few extra flops only.
+
+// Unit roundoff of double (2^-53) and the error bounds derived from it
+constexpr double PRED_ROUNDOFF = 1.1102230246251565e-16;
+constexpr double CCW_ERRBOUND = (3.0 + 16.0 * PRED_ROUNDOFF) * PRED_ROUNDOFF;
+constexpr double O3D_ERRBOUND = (7.0 + 56.0 * PRED_ROUNDOFF) * PRED_ROUNDOFF;
+
+// Exact fallbacks, only called when the fast path cannot decide the sign
+double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy);
+double orient2dDeltaExact(double ax, double ay, double bx, double by,
+                          double px, double py, double qx, double qy);
+double orient3dExact(double ax, double ay, double az, double bx, double by, double bz,
+                     double cx, double cy, double cz, double dx, double dy, double dz);
+
+// Twice the signed area of triangle abc: > 0 when a, b, c turn counter-clockwise,
+// < 0 when clockwise, 0 when collinear. Same sign convention as cross(a, b, c).
+inline double orient2d(double ax, double ay, double bx, double by, double cx, double cy) {
+    // relative to a, so that loops over c with a fixed edge ab hoist b - a
+    double detLeft = (bx - ax) * (cy - ay);
+    double detRight = (by - ay) * (cx - ax);
+    double det = detLeft - detRight;
+
+    double errBound = CCW_ERRBOUND * (std::fabs(detLeft) + std::fabs(detRight));
+    if (det > errBound || -det > errBound) return det;
+    return orient2dExact(ax, ay, bx, by, cx, cy);
+}
+
+inline double orient2d(const Point& a, const Point& b, const Point& c) {
+    return orient2d(a.x, a.y, b.x, b.y, c.x, c.y);
+}
+
+// cross(a, b, p) - cross(a, b, q) = (b-a) × (p-q): > 0 when p lies farther left of
+// line ab than q. Same error bound as orient2d (two rounded differences per product).
+inline double orient2dDelta(double ax, double ay, double bx, double by,
+                            double px, double py, double qx, double qy) {
+    double detLeft = (bx - ax) * (py - qy);
+    double detRight = (by - ay) * (px - qx);
+    double det = detLeft - detRight;
+
+    double errBound = CCW_ERRBOUND * (std::fabs(detLeft) + std::fabs(detRight));
+    if (det > errBound || -det > errBound) return det;
+    return orient2dDeltaExact(ax, ay, bx, by, px, py, qx, qy);
+}
+
+// Six times the signed volume of tetrahedron abcd: > 0 when d lies on the side of
+// plane abc that the normal (b-a)×(c-a) points to, < 0 on the other side, 0 when the
+// four points are coplanar. Same sign as Plane::signedDistance of a plane built from abc
+// (the opposite of Shewchuk's convention).
+inline double orient3d(double ax, double ay, double az, double bx, double by, double bz,
+                       double cx, double cy, double cz, double dx, double dy, double dz) {
+    double adx = ax - dx, bdx = bx - dx, cdx = cx - dx;
+    double ady = ay - dy, bdy = by - dy, cdy = cy - dy;
+    double adz = az - dz, bdz = bz - dz, cdz = cz - dz;
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+                     + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+                     + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+
+    double errBound = O3D_ERRBOUND * permanent;
+    if (det > errBound || -det > errBound) return -det;
+    return orient3dExact(ax, ay, az, bx, by, bz, cx, cy, cz, dx, dy, dz);
+}
+
+// ===== Kernel-generic wrappers =====
+// Exact kernels evaluate directly in area_type; float and double go through the
+// filtered predicates above (float input is widened to double losslessly).
+
+// Sign of cross(a, b, c)
+template <typename T>
+inline int orientation(const BasicPoint<T>& a, const BasicPoint<T>& b, const BasicPoint<T>& c) {
+    if constexpr (CoordTraits<T>::exact) {
+        auto d = cross(a, b, c);
+        return (d > 0) - (d < 0);
+    } else {
+        double d = orient2d(a.x, a.y, b.x, b.y, c.x, c.y);
+        return (d > 0) - (d < 0);
+    }
+}
+
+// Is p strictly farther left of edge a->b than q? Points at the same distance are
+// ordered along a->b, the one closer to b winning, so the winner of a scan is always
+// a strict hull vertex. Exactly equal points are never farther than each other.
+template <typename T>
+inline bool fartherFromEdge(const BasicPoint<T>& a, const BasicPoint<T>& b,
+                            const BasicPoint<T>& p, const BasicPoint<T>& q) {
+    int s;
+    if constexpr (CoordTraits<T>::exact) {
+        auto d = cross(a, b, p) - cross(a, b, q);
+        s = (d > 0) - (d < 0);
+    } else {
+        double d = orient2dDelta(a.x, a.y, b.x, b.y, p.x, p.y, q.x, q.y);
+        s = (d > 0) - (d < 0);
+    }
+    if (s != 0) return s > 0;
+    // p - q is parallel to b - a here, so one coordinate decides the order along it
+    if (a.x != b.x) return (b.x > a.x) ? p.x > q.x : p.x < q.x;
+    return (b.y > a.y) ? p.y > q.y : p.y < q.y;
+}
+
+// Running maximum of fartherFromEdge over a scan. Floating kernels keep the rounded
+// cross product of the current winner with its error bound, so almost every candidate
+// is decided by one cross product; only near-ties go to the exact comparison.
+template <typename T>
+class FarthestFromEdgeScan {
+public:
+    FarthestFromEdgeScan(const BasicPoint<T>& a, const BasicPoint<T>& b) : a_(a), b_(b) {}
+
+    // Does p beat every point offered so far? Always true for the first one.
+    bool offer(const BasicPoint<T>& p) {
+        if constexpr (CoordTraits<T>::exact) {
+            if (empty_ || fartherFromEdge(a_, b_, p, best_)) { best_ = p; empty_ = false; return true; }
+            return false;
+        } else {
+            double l = ((double)b_.x - a_.x) * ((double)p.y - a_.y);
+            double r = ((double)b_.y - a_.y) * ((double)p.x - a_.x);
+            double c = l - r, err = CCW_ERRBOUND * (std::fabs(l) + std::fabs(r));
+            if (!empty_) {
+                // twice the summed bounds also covers the rounding of c - bestArea_
+                double slack = 2 * (err + bestErr_);
+                if (bestArea_ - c > slack) return false;
+                if (c - bestArea_ <= slack && !fartherFromEdge(a_, b_, p, best_)) return false;
+            }
+            best_ = p; bestArea_ = c; bestErr_ = err; empty_ = false;
+            return true;
+        }
+    }
+
+private:
+    BasicPoint<T> a_, b_, best_{};
+    double bestArea_ = 0, bestErr_ = 0;
+    bool empty_ = true;
+};
+
+#endif
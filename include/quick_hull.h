@@ -4,7 +4,10 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
 #include "point.h"
+#include "point_soa.h"
+#include "point_view.h"
 
 // Deduplicate hull points
 void deduplicateHull(std::vector<Point>& hull);
@@ -18,8 +21,60 @@ void sortCounterClockwise(std::vector<Point>& hull);
 void quickHullRec(const std::vector<Point>& pts, const Point& A, const Point& B,
                   std::vector<Point>& hull);
 
+// Partition-based helper used by quickHull: [first, last) must hold only points strictly
+// outside edge A->B. The range is reordered in place so that each recursive call only
+// scans the points outside its own edge (A,pivot) or (pivot,B).
+// Appends the hull vertices from B back to A (excluding B, including A) in CCW order.
+template <typename T>
+void quickHullPartitionRec(typename std::vector<BasicPoint<T>>::iterator first,
+                           typename std::vector<BasicPoint<T>>::iterator last,
+                           const BasicPoint<T>& A, const BasicPoint<T>& B,
+                           std::vector<BasicPoint<T>>& hull);
+
 // QuickHull main: define the closest point A and the furthest point B based on X asis.
 // run recursively at 2 parts: lower (A->B) and upper (B->A)
-std::vector<Point> quickHull(std::vector<Point> pts);
+// The recursion already walks the boundary, so the hull comes back in counter-clockwise
+// order starting at the leftmost point, without duplicates.
+// Side-of-line tests use the exact orientation predicate (predicates.h), so collinear
+// and nearly collinear points are classified the same way at any coordinate scale.
+// Instantiated for float, double and int64_t coordinates (see CoordTraits in point.h).
+template <typename T>
+std::vector<BasicPoint<T>> quickHull(std::vector<BasicPoint<T>> pts);
+
+// QuickHull with an optional Akl–Toussaint prefilter stage (see akl_toussaint.h).
+// When `removed` is given it receives the number of points the prefilter threw away.
+std::vector<Point> quickHull(std::vector<Point> pts, bool prefilter, size_t* removed = nullptr);
+
+// QuickHull reading straight from caller memory (see point_view.h). Only the points
+// outside the Akl–Toussaint polygon are copied, into `scratch`, which can be reused
+// across calls. Writes up to
+// `capacity` hull vertices to `out` and returns the hull size, so a return value above
+// capacity means the buffer was too small. Same vertices, in the same order, as quickHull.
+size_t quickHull(const PointView& in, Point* out, size_t capacity, std::vector<Point>& scratch);
+
+// QuickHull returning positions into `in` instead of point copies, in the same
+// counter-clockwise order as quickHull. Throws std::length_error for 2^32 or more points.
+std::vector<uint32_t> quickHullIndices(const PointView& in);
+
+// Parallel QuickHull: upper/lower sides and independent sub-problems run concurrently
+// on one pool of `threads` threads (0: one per core, see fork_join_pool.h). Finding the
+// extremes and the farthest points, and splitting each range into its outside sets
+// (per-block counts, a prefix sum, then a concurrent scatter into a second buffer), are
+// parallel too. Sub-problems smaller than `cutoff` points use the serial recursion;
+// one thread, or fewer than `cutoff` points in all, is plain quickHull.
+// Returns the same vertices, in the same order, as quickHull.
+std::vector<Point> quickHullParallel(std::vector<Point> pts, size_t cutoff = 1 << 15,
+                                     unsigned threads = 0);
+
+// QuickHull on structure-of-arrays input: the extremes, the farthest-point search and the
+// side-of-line partition run on the AVX2 / AVX-512 kernels of point_soa.h when the build enables them.
+// The kernels compare against the EPS distance tolerance instead of the exact predicate,
+// so points within EPS of a hull edge may be classified differently than by quickHull.
+std::vector<Point> quickHullSoA(const PointsSoA& pts);
+
+// Same, with the working buffers in `scratch` (grown to 2n points, never shrunk), so
+// repeated hulls reuse memory that is already mapped instead of faulting in 4n fresh
+// doubles per call.
+std::vector<Point> quickHullSoA(const PointsSoA& pts, PointsSoA& scratch);
 
 #endif
\ No newline at end of file
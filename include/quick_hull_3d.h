@@ -4,7 +4,9 @@
 #pragma once
 #include <vector>
 #include <array>
+#include <queue>
 #include <cmath> 
+#include <cstddef>
 
 namespace qh3d {
 
@@ -27,6 +29,44 @@ inline Vec3 cross(const Vec3& a, const Vec3& b) {
 inline double dot(const Vec3& a, const Vec3& b) { return a.x*b.x + a.y*b.y + a.z*b.z; }
 inline double norm(const Vec3& v) { return std::sqrt(dot(v,v)); }
 
+// Non-owning view over 3D points in the caller's memory: pointers to the first x, y
+// and z plus the byte distance between consecutive points. Covers Vec3 arrays, fields
+// of larger records and separate x[] / y[] / z[] columns. The data must outlive it.
+struct PointView3D {
+    const double* x = nullptr;
+    const double* y = nullptr;
+    const double* z = nullptr;
+    size_t n = 0;
+    size_t stride = sizeof(double);
+
+    PointView3D() = default;
+    PointView3D(const double* X, const double* Y, const double* Z, size_t count, size_t strideBytes)
+        : x(X), y(Y), z(Z), n(count), stride(strideBytes) {}
+    // a std::vector<Vec3> converts implicitly, so vector callers keep working
+    PointView3D(const std::vector<Vec3>& pts)
+        : x(field(pts, offsetof(Vec3, x))), y(field(pts, offsetof(Vec3, y))),
+          z(field(pts, offsetof(Vec3, z))), n(pts.size()), stride(sizeof(Vec3)) {}
+
+    size_t size() const { return n; }
+
+    Vec3 operator[](size_t i) const {
+        auto at = [&](const double* base) {
+            return *reinterpret_cast<const double*>(reinterpret_cast<const char*>(base) + i * stride);
+        };
+        return {at(x), at(y), at(z)};
+    }
+
+private:
+    static const double* field(const std::vector<Vec3>& pts, size_t offset) {
+        return reinterpret_cast<const double*>(reinterpret_cast<const char*>(pts.data()) + offset);
+    }
+};
+
+// Separate coordinate columns
+inline PointView3D pointColumns3D(const double* x, const double* y, const double* z, size_t n) {
+    return {x, y, z, n, sizeof(double)};
+}
+
 // Directed plane: n·X + d = 0 (n points outward)
 struct Plane {
     Vec3 n{};
@@ -38,37 +78,66 @@ struct Plane {
 struct Face {
     // indices into points array, oriented CCW when viewed from outside
     std::array<int,3> v{};
+    // nb[i]: face on the other side of edge v[i] -> v[(i+1)%3]. With the implicit next
+    // edge (i+1)%3 this is a half-edge mesh: the twin of edge i is the edge of nb[i]
+    // running v[(i+1)%3] -> v[i].
+    std::array<int,3> nb{-1,-1,-1};
     Plane plane{};
-    // points outside this face (candidates) stored as indices
+    // points above this face that it owns, as indices: each point still outside the
+    // hull sits in exactly one face's set
     std::vector<int> outside;
+    // the outside point farthest above the face, kept up to date as points are added
+    int farthest{-1};
+    double farthestDist{0};
     bool alive{true};
+    // scratch for the expansion step in progress: position in the visible list
+    int mark{-1};
+    // bumped each time the slot is reused, so stale references to it can be told apart
+    unsigned gen{0};
 };
 
-// Undirected edge key for hashing (min, max)
-struct UEdge {
-    int a, b;
-    UEdge(int i, int j) { if (i<j){a=i;b=j;} else {a=j;b=i;} }
-    bool operator==(const UEdge& o) const { return a==o.a && b==o.b; }
+// faceQueue entry: a face and the slot generation it was queued under
+struct QueuedFace {
+    double dist;
+    int face;
+    unsigned gen;
+    bool operator<(const QueuedFace& o) const { return dist < o.dist; }
 };
-struct UEdgeHash {
-    size_t operator()(const UEdge& e) const {
-        return (size_t)e.a * 11400714819323198485ull ^ (size_t)e.b;
-    }
+
+// Horizon edge u->v, cut from the visible face at position `from` of the visible list;
+// `across` is the face that stays on the other side of it
+struct HorizonEdge {
+    int u, v;
+    int from;
+    int across;
 };
 
 // -------------------- QuickHull 3D --------------------
 
 struct QuickHull3D {
-    const std::vector<Vec3>& pts;
-    double eps; // tolerance
+    PointView3D pts;
+    double eps; // tolerance; 0 switches visibility tests to the exact orient3d predicate
+    // face pool: dead faces' slots go on freeFaces and are reused by later faces
     std::vector<Face> faces;
+    std::vector<int> freeFaces;
+    // faces with outside points by farthest distance; dead faces are skipped when popped
+    std::priority_queue<QueuedFace> faceQueue;
+    // the pool is compacted once more than this many slots sit idle through a step's
+    // allocations, i.e. the hull has shrunk by that many faces since the last compaction
+    size_t compactMinFree;
 
-    QuickHull3D(const std::vector<Vec3>& points, double epsilon=1e-9);
+    // Throws std::length_error for more than 2^31 - 1 points, past what int indices address
+    QuickHull3D(const PointView3D& points, double epsilon=1e-9, size_t compactMinFree=4096);
 
     // public API: compute convex hull faces (as triplets of indices)
     std::vector<std::array<int,3>> compute();
 
+    // same, writing up to `capacity` faces to `out`; returns the face count
+    size_t compute(std::array<int,3>* out, size_t capacity);
+
 private:
+    bool build();
+
     // choose initial tetrahedron: four non-coplanar extreme points
     std::array<int,4> initialTetrahedron();
 
@@ -79,37 +148,78 @@ private:
 
     void initTetraFaces(const std::array<int,4>& T);
 
+    // signed distance of point p above face f; with eps == 0 its sign is exact
+    double distanceAbove(const Face& f, int p) const;
+
     void assignOutsidePoints();
 
-    // pick a face that currently has outside points
-    int pickFaceWithOutside() const;
+    // a fresh face slot, recycled from freeFaces when possible
+    int allocFace();
 
-    // find farthest point from a face among its outside set
-    int farthestPointFromFace(const Face& f) const;
+    // move the live faces to the front of the pool and drop the free list, remapping
+    // neighbour links and faceQueue: memory back to the size of the live hull
+    void compactFaces();
+
+    // add p, at distance d above face f, to f's outside set
+    void addOutside(int f, int p, double d);
+
+    // put face f on faceQueue once its outside set is complete (if it is not empty)
+    void queueFace(int f);
 
-    // mark all faces visible from point p
-    void collectVisibleFaces(int p, std::vector<int>& visible) const;
+    // pick a face that currently has outside points: O(log F) via faceQueue
+    int pickFaceWithOutside();
 
-    // Find horizon as list of directed edges (u->v) bordering a visible and a non-visible face
-    // We collect undirected edge counts among visible faces; edges with count==1 lie on boundary.
-    // Then we orient each boundary edge so that the winding with the new apex will be CCW outward.
-    std::vector<std::pair<int,int>> computeHorizon(const std::vector<int>& visible);
+    // farthest point from a face among its outside set (cached, -1 if none)
+    int farthestPointFromFace(const Face& f) const;
 
-    // Reassign points from a set of removed faces to the new faces' outside sets
+    // All faces visible from point p, found by a flood fill over neighbouring faces from
+    // `start`, which p must be above: the cost is proportional to the visible region, not
+    // to the whole hull. Sets each visible face's mark to its position in `visible`.
+    void collectVisibleFaces(int start, int p, std::vector<int>& visible);
+
+    // index of the edge of face f that starts at vertex a (-1: a is not on f)
+    int edgeStartingAt(int f, int a) const;
+
+    // Horizon as a closed loop of directed edges (u->v) bordering the visible faces, which
+    // must already be dead. Walks the mesh: from each horizon edge it turns around the
+    // edge's end vertex through dead faces until it finds the next one. Each edge keeps
+    // its visible face's winding, so (u, v, apex) is CCW outward. Throws
+    // std::runtime_error when the walk does not close: the mesh links are broken.
+    std::vector<HorizonEdge> computeHorizon(const std::vector<int>& visible);
+
+    // Reassign points from a set of removed faces, apex excepted, to the new faces'
+    // outside sets. newFaceIdx runs around the horizon; ringStart[i] is the position in it
+    // of the first new face built on an edge of removedFaces[i] (-1: no horizon edge).
+    // Each orphan is tested against the new faces next to its old face first, then
+    // outwards around the ring, and goes to the first face it is above. Orphans inside
+    // the new hull are above none, so they are tested against all of them.
     void reassignOutsidePoints(
+        int apex,
         const std::vector<int>& removedFaces,
-        const std::vector<int>& newFaceIdx);
+        const std::vector<int>& newFaceIdx,
+        const std::vector<int>& ringStart);
 
     void expand();
 };
 
+// eps > 0: points within eps of a face count as inside.
+// eps == 0: exact visibility (predicates.h), no tolerance to tune per data set.
 inline std::vector<std::array<int,3>> 
-convex_hull_3d(const std::vector<Vec3>& points, double eps=1e-9)
+convex_hull_3d(const PointView3D& points, double eps=1e-9)
 {
     QuickHull3D qh(points, eps);
     return qh.compute();
 }
 
+// Same, writing up to `capacity` faces to the caller's buffer. Returns the face count,
+// so a return value above capacity means the buffer was too small.
+inline size_t
+convex_hull_3d(const PointView3D& points, std::array<int,3>* out, size_t capacity, double eps=1e-9)
+{
+    QuickHull3D qh(points, eps);
+    return qh.compute(out, capacity);
+}
+
 } // namespace qh3d
 
 
@@ -0,0 +1,33 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include "point.h"
+
+// grahamHull switches from std::sort to radixSortPoints at this many points
+const size_t RADIX_SORT_THRESHOLD = 1 << 16;
+
+// Map a double to a 64-bit key with the same ordering: flip every bit of negative
+// numbers, only the sign bit of positive ones. -0.0 is folded onto +0.0 so that keys
+// tie exactly where the comparison operators do.
+inline uint64_t orderedKey(double v) {
+    if (v == 0) v = 0.0;
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof bits);
+    return (bits >> 63) ? ~bits : bits | (1ull << 63);
+}
+
+// Sort points by x, then y (the grahamHull order) with a radix sort on the key pair
+// (orderedKey(x), orderedKey(y)): 8-bit digits from the most significant byte of x
+// down, ping-ponging between pts and scratch. Digits every point of a bucket shares
+// (sign/exponent bytes) are skipped, and small buckets finish with std::sort.
+// `scratch` is resized to pts.size() and can be reused across calls.
+void radixSortPoints(std::vector<Point>& pts, std::vector<Point>& scratch);
+
+// Same on pts[0, n), with room for n points at scratch
+void radixSortPoints(Point* pts, Point* scratch, size_t n);
+
+#endif
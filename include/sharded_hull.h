@@ -0,0 +1,35 @@
+#ifndef SHARDED_HULL_H
+#define SHARDED_HULL_H
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "point.h"
+#include "point_view.h"
+#include "quick_hull_3d.h"
+
+// ===== Multi-process sharded hulls (Linux) =====
+// The input is cut into `processes` contiguous shards and one child process is forked
+// per shard (0 = one per core). Children read their shard straight from the parent's
+// memory (copy-on-write: the input is not copied unless someone writes to it), hull it
+// into their own heap, and publish the indices of the surviving vertices through a
+// POSIX shared memory segment. The parent then hulls only those vertices. Children are
+// not pinned to cores or NUMA nodes, and the input pages stay wherever the parent
+// touched them, so this spreads the work over processes, not over memory nodes.
+// fork() only clones the calling thread, and children allocate: if another thread of the
+// caller holds a lock a child then needs (an allocator, stdio, or one of your own), that
+// child can deadlock. Call these from a single-threaded process, or where no other
+// thread can be holding such a lock.
+// Inputs below `cutoff` points per process, or over 2^32 - 1 points (2D), run in-process.
+// Throws std::runtime_error when a worker cannot be started or fails.
+
+// 2D: quickHull per shard. Same vertices, in the same order, as quickHull of the input.
+std::vector<Point> shardedHull(const PointView& in, unsigned processes = 0, size_t cutoff = 1 << 16);
+
+// 3D: QuickHull3D per shard; faces index into `in`. A shard too degenerate for a hull
+// (fewer than 4 points, coplanar) publishes all of its points. Throws std::length_error
+// for more than 2^31 - 1 points, which int face indices cannot address.
+std::vector<std::array<int,3>> shardedHull3D(const qh3d::PointView3D& in, unsigned processes = 0,
+                                             double eps = 1e-9, size_t cutoff = 1 << 16);
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef SLIDING_WINDOW_HULL_H
+#define SLIDING_WINDOW_HULL_H
+
+#include <vector>
+#include <deque>
+#include <cstddef>
+#include "point.h"
+#include "dynamic_hull.h"
+
+// Convex Hull of the points pushed during the last `window` time units.
+// Points are evicted in FIFO order, so timestamps must not decrease. The window
+// contents live in a DynamicHull2D (polylog push and evict); the hull read out of it
+// is cached, and a push that lands inside the cached hull or an eviction of a point
+// that isn't one of its vertices leaves the cache valid, both checked in O(log h).
+class SlidingWindowHull2D {
+public:
+    explicit SlidingWindowHull2D(double window) : window(window) {}
+
+    // Add p observed at time t and evict every point not newer than t - window
+    void push(double t, const Point& p);
+
+    // Evict every point not newer than now - window, without pushing anything
+    void advance(double now);
+
+    // Hull of the points in the window, identical to grahamHull on them
+    const std::vector<Point>& hull();
+
+    size_t size() const { return points.size(); }
+    bool empty() const { return points.empty(); }
+
+private:
+    struct Stamped {
+        double t;
+        Point p;
+    };
+
+    // Does the cached hull stay valid when p is added / removed?
+    bool cacheCovers(const Point& p) const;
+    bool cacheHasVertex(const Point& p) const;
+    void refreshCache();
+
+    double window;
+    std::deque<Stamped> points;
+    DynamicHull2D dynamic;
+
+    std::vector<Point> cached;
+    size_t cachedRight = 0;     // index of the lexicographically largest cached vertex
+    bool cacheValid = true;
+};
+
+#endif
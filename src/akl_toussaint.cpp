@@ -0,0 +1,50 @@
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "point.h"
+#include "point_view.h"
+#include "akl_toussaint.h"
+#include "predicates.h"
+
+// Extreme-point polygon of the Akl–Toussaint heuristic
+size_t aklToussaintPolygon(const PointView& pts, Point poly[8]) {
+    const size_t n = pts.size();
+    if (n < 4) return 0;
+
+    // Extremes in counter-clockwise order of their directions:
+    // bottom, bottom-right, right, top-right, top, top-left, left, bottom-left
+    Point ext[8];
+    std::fill(ext, ext + 8, pts[0]);
+    for (size_t i = 0; i < n; i++) {
+        const Point p = pts[i];
+        if (p.y < ext[0].y) ext[0] = p;
+        if (p.x - p.y > ext[1].x - ext[1].y) ext[1] = p;
+        if (p.x > ext[2].x) ext[2] = p;
+        if (p.x + p.y > ext[3].x + ext[3].y) ext[3] = p;
+        if (p.y > ext[4].y) ext[4] = p;
+        if (p.y - p.x > ext[5].y - ext[5].x) ext[5] = p;
+        if (p.x < ext[6].x) ext[6] = p;
+        if (p.x + p.y < ext[7].x + ext[7].y) ext[7] = p;
+    }
+
+    // Extremes of neighbouring directions often coincide: keep distinct corners only
+    size_t m = 0;
+    for (auto& p : ext) {
+        if (m == 0 || !(poly[m-1].x == p.x && poly[m-1].y == p.y)) poly[m++] = p;
+    }
+    while (m > 1 && poly[0].x == poly[m-1].x && poly[0].y == poly[m-1].y) m--;
+    return m < 3 ? 0 : m;
+}
+
+// Akl–Toussaint prefilter
+size_t aklToussaintFilter(std::vector<Point>& pts) {
+    Point poly[8];
+    size_t m = aklToussaintPolygon(pts.data(), pts.size(), poly);
+    if (m == 0) return 0;
+
+    size_t before = pts.size();
+    pts.erase(std::remove_if(pts.begin(), pts.end(),
+                             [&](const Point& p) { return aklToussaintInside(poly, m, p); }),
+              pts.end());
+    return before - pts.size();
+}
@@ -0,0 +1,99 @@
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include "point.h"
+#include "monotone_chain.h"
+#include "akl_toussaint.h"
+#include "batch_hull.h"
+#include "fork_join_pool.h"
+
+// Below this many points in total the batch runs on the calling thread
+static const size_t BATCH_PARALLEL_CUTOFF = 1 << 14;
+
+// A point together with its position in the flat input
+struct IndexedPoint {
+    Point p;
+    uint32_t idx;
+};
+
+// Reused per-worker state: sorted copy of the group, hull stack and the worker's
+// share of the output
+struct BatchWorker {
+    std::vector<IndexedPoint> sorted;
+    std::vector<IndexedPoint> stack;
+    std::vector<uint32_t> indices;
+};
+
+// grahamHull on points[first, last), appending the hull's indices to w.indices.
+// Sorting a contiguous copy beats sorting indices: comparisons never leave the buffer.
+// Returns the number of hull vertices.
+static uint32_t groupHull(const std::vector<Point>& points, uint32_t first, uint32_t last,
+                          BatchWorker& w) {
+    uint32_t n = last - first;
+    if (n <= 1) {
+        if (n == 1) w.indices.push_back(first);
+        return n;
+    }
+
+    // points strictly inside the Akl–Toussaint polygon can't be vertices: skip them
+    // while copying, so the sort only sees the few that can
+    Point poly[8];
+    size_t m = aklToussaintPolygon(points.data() + first, n, poly);
+    w.sorted.clear();
+    for (uint32_t i = first; i < last; i++) {
+        if (m == 0 || !aklToussaintInside(poly, m, points[i])) w.sorted.push_back({points[i], i});
+    }
+    n = w.sorted.size();
+
+    std::sort(w.sorted.begin(), w.sorted.end(), [](const IndexedPoint& a, const IndexedPoint& b) {
+        return a.p.x < b.p.x || (a.p.x == b.p.x && (a.p.y < b.p.y || (a.p.y == b.p.y && a.idx < b.idx)));
+    });
+
+    monotoneChain(w.sorted, [](const IndexedPoint& e) -> const Point& { return e.p; }, w.stack);
+    for (const IndexedPoint& v : w.stack) w.indices.push_back(v.idx);
+    return w.stack.size();
+}
+
+HullBatch batchHulls(const std::vector<Point>& points, const std::vector<uint32_t>& groupOffsets,
+                     unsigned threads) {
+    HullBatch out;
+    const size_t groups = groupOffsets.empty() ? 0 : groupOffsets.size() - 1;
+    out.offsets.assign(groups + 1, 0);
+    if (groups == 0) return out;
+
+    const size_t total = groupOffsets[groups] - groupOffsets[0];
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t workers = std::min<size_t>(threads, std::max<size_t>(1, total / BATCH_PARALLEL_CUTOFF));
+    workers = std::min(workers, groups);
+
+    // contiguous runs of groups with about the same number of points each;
+    // the hull sizes go to out.offsets[g+1] and become offsets below
+    std::vector<size_t> bounds(workers + 1, groups);
+    bounds[0] = 0;
+    for (size_t w = 1; w < workers; w++) {
+        uint32_t target = groupOffsets[0] + (uint32_t)(total * w / workers);
+        bounds[w] = std::lower_bound(groupOffsets.begin(), groupOffsets.end() - 1, target) - groupOffsets.begin();
+        bounds[w] = std::max(bounds[w], bounds[w-1]);
+    }
+
+    std::vector<BatchWorker> state(workers);
+    auto run = [&](size_t w) {
+        auto& s = state[w];
+        s.indices.reserve(groupOffsets[bounds[w+1]] - groupOffsets[bounds[w]]);
+        for (size_t g = bounds[w]; g < bounds[w+1]; g++)
+            out.offsets[g+1] = groupHull(points, groupOffsets[g], groupOffsets[g+1], s);
+    };
+
+    if (workers == 1) {
+        run(0);
+    } else {
+        ForkJoinPool pool((unsigned)workers);
+        pool.parallelFor(workers, run);
+    }
+
+    for (size_t g = 0; g < groups; g++) out.offsets[g+1] += out.offsets[g];
+    out.indices.reserve(out.offsets[groups]);
+    for (auto& s : state) out.indices.insert(out.indices.end(), s.indices.begin(), s.indices.end());
+    return out;
+}
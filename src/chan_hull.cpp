@@ -0,0 +1,118 @@
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "point.h"
+#include "graham_hull.h"
+#include "chan_hull.h"
+#include "predicates.h"
+
+static inline bool samePoint(const Point& a, const Point& b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+// Jarvis order seen from p: does `cand` wrap before `best`?
+// cand wins when it lies right of p->best, or on that ray but farther away.
+// Points equal to p never win.
+static bool wrapsBefore(const Point& p, const Point& cand, const Point& best) {
+    if (samePoint(cand, p)) return false;
+    if (samePoint(best, p)) return true;
+    double c = orient2d(p, best, cand);
+    if (c != 0) return c < 0;
+    double dc = (cand.x - p.x) * (cand.x - p.x) + (cand.y - p.y) * (cand.y - p.y);
+    double db = (best.x - p.x) * (best.x - p.x) + (best.y - p.y) * (best.y - p.y);
+    return dc > db;
+}
+
+// ===== Tangent from p to a convex polygon =====
+// Seen from p, the wrap order along the polygon rises to one tangent and falls to
+// the other, so the maximum can be found by binary search on that cyclic sequence.
+size_t chanTangent(const std::vector<Point>& poly, const Point& p) {
+    const size_t m = poly.size();
+    auto beats = [&](size_t j, size_t i) { return wrapsBefore(p, poly[j % m], poly[i % m]); };
+    auto isPeak = [&](size_t i) { return !beats(i + 1, i) && !beats(i + m - 1, i); };
+
+    auto linear = [&] {
+        size_t best = 0;
+        for (size_t i = 1; i < m; i++) if (beats(i, best)) best = i;
+        return best;
+    };
+
+    if (m <= 3) return linear();
+    if (isPeak(0)) return 0;
+
+    // the peak is in (lo, hi]; index m stands for vertex 0, which isn't the peak
+    size_t lo = 0, hi = m;
+    while (hi - lo > 1) {
+        size_t c = (lo + hi) / 2;
+        bool upC = beats(c + 1, c);
+        if (!upC && !beats(c - 1, c)) return c;
+
+        bool upLo = beats(lo + 1, lo);
+        if (upLo) {
+            if (!upC || beats(lo, c)) hi = c;   // already past the peak
+            else lo = c;                        // still on the rising run
+        } else {
+            if (upC || !beats(c, lo)) lo = c;   // still before the rise
+            else hi = c;                        // on the falling run after the peak
+        }
+    }
+
+    size_t best = beats(hi, lo) ? hi % m : lo;
+    // Degenerate input (p on the polygon, repeated vertices) can break the
+    // unimodal shape; fall back to a plain scan when the result isn't a peak.
+    return isPeak(best) ? best : linear();
+}
+
+// ===== Chan's algorithm =====
+std::vector<Point> chanHull(std::vector<Point> points) {
+    const size_t n = points.size();
+    if (n < 3) return grahamHull(points);
+
+    // grahamHull starts at the lowest x, then lowest y
+    Point start = *std::min_element(points.begin(), points.end(),
+        [](const Point& a, const Point& b) { return a.x < b.x || (a.x == b.x && a.y < b.y); });
+
+    std::vector<std::vector<Point>> miniHulls;
+    std::vector<Point> group;
+
+    // Start at m = 2^(2^3) = 256: smaller groups cost more in per-group overhead
+    // than they save, and a constant start keeps the O(n log h) bound.
+    for (int t = 3; ; t++) {
+        const size_t count = points.size();
+        // m = 2^(2^t), capped at the point count (t >= 6 would overflow)
+        size_t m = (t >= 6) ? count : std::min(count, (size_t)1 << (1u << t));
+
+        // 1) mini-hulls of consecutive groups of m points
+        miniHulls.clear();
+        for (size_t lo = 0; lo < count; lo += m) {
+            size_t hi = std::min(count, lo + m);
+            group.assign(points.begin() + lo, points.begin() + hi);
+            miniHulls.push_back(grahamHull(group));
+        }
+
+        // 2) at most m Jarvis steps, each picking the best tangent over the mini-hulls
+        std::vector<Point> hull{start};
+        Point p = start;
+        bool closed = false;
+        for (size_t step = 0; step < m; step++) {
+            const Point* next = nullptr;
+            for (auto& mh : miniHulls) {
+                const Point& q = mh[chanTangent(mh, p)];
+                if (!next || wrapsBefore(p, q, *next)) next = &q;
+            }
+            if (!next || samePoint(*next, p) || samePoint(*next, start)) {
+                closed = true;
+                break;
+            }
+            p = *next;
+            hull.push_back(p);
+        }
+
+        if (closed) return hull;
+
+        // 3) h > m: square the guess and retry. A point that isn't on its own
+        // mini-hull can't be on the final hull either, so only those carry over.
+        points.clear();
+        for (auto& mh : miniHulls) points.insert(points.end(), mh.begin(), mh.end());
+    }
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <stdexcept>
+#include "quick_hull.h"
+#include "graham_hull.h"
+#include "quick_hull_3d.h"
+#include "point_file.h"
+#include "out_of_core_hull.h"
+
+// Headless hull CLI: links only the algorithm library, so it runs on machines without
+// SFML, GLFW, OpenGL or X11
+
+static int usage() {
+    std::cerr << "usage: convex_hull_cli IN OUT [options]   hull of a binary point file (see point_file.h)\n"
+                 "  --engine quick|graham   2D engine (default quick); 3D files always use QuickHull3D\n"
+                 "  --vertices              write the hull as a point file instead of uint32 indices\n"
+                 "                          (3D: three corners per face)\n"
+                 "  --chunk POINTS          2D only: stream the file POINTS records at a time instead\n"
+                 "                          of mapping it (for files larger than RAM; implies --vertices)\n";
+    return 2;
+}
+
+// Hull of a memory-mapped point file, no windows
+int main(int argc, char** argv) {
+    std::string engine = "quick";
+    bool vertices = false;
+    size_t chunk = 0;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--engine") == 0 && i + 1 < argc) engine = argv[++i];
+        else if (std::strcmp(argv[i], "--vertices") == 0) vertices = true;
+        else if (std::strcmp(argv[i], "--chunk") == 0 && i + 1 < argc) chunk = std::strtoull(argv[++i], nullptr, 10);
+        else if (argv[i][0] == '-') return usage();
+        else files.push_back(argv[i]);
+    }
+    if (files.size() != 2 || (engine != "quick" && engine != "graham")) return usage();
+
+    try {
+        auto start = std::chrono::steady_clock::now();
+        if (chunk > 0) {
+            size_t chunks = 0;
+            auto hull = outOfCoreHull(files[0], chunk, &chunks);
+            writePointFile(files[1], hull);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::cout << chunks << " chunks -> " << hull.size() << " hull vertices in " << ms << " ms\n";
+            return 0;
+        }
+
+        MappedPointFile in(files[0]);
+        // 2D indices are uint32; QuickHull3D rejects 3D files past its int indices itself
+        if (in.size() > UINT32_MAX) throw std::runtime_error(files[0] + ": more than 2^32 - 1 points");
+
+        size_t hullSize;
+        if (in.dim() == 2) {
+            PointView view = in.view2D();
+            auto idx = engine == "quick" ? quickHullIndices(view) : grahamHullIndices(view);
+            if (vertices) {
+                std::vector<Point> hull;
+                for (uint32_t i : idx) hull.push_back(view[i]);
+                writePointFile(files[1], hull);
+            } else {
+                writeIndexFile(files[1], idx.data(), idx.size());
+            }
+            hullSize = idx.size();
+        } else {
+            qh3d::PointView3D view = in.view3D();
+            auto faces = qh3d::convex_hull_3d(view, 0.0);
+            if (vertices) {
+                std::vector<qh3d::Vec3> corners;
+                for (auto& f : faces)
+                    for (int v : f) corners.push_back(view[v]);
+                writePointFile(files[1], corners);
+            } else {
+                std::vector<uint32_t> idx;
+                for (auto& f : faces)
+                    for (int v : f) idx.push_back(v);
+                writeIndexFile(files[1], idx.data(), idx.size());
+            }
+            hullSize = faces.size();
+        }
+
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << in.size() << " points -> " << hullSize << (in.dim() == 2 ? " hull vertices" : " hull faces")
+                  << " in " << ms << " ms\n";
+    } catch (const std::exception& e) {
+        std::cerr << "convex_hull_cli: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
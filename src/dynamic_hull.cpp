@@ -0,0 +1,266 @@
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include "point.h"
+#include "predicates.h"
+#include "dynamic_hull.h"
+
+// The lower hull is the upper hull of the points rotated by 180°, (x, y) -> (-x, -y).
+// Each side is handled by the same upper-hull code, in its own coordinates, where the
+// rotation also swaps which child holds the smaller points.
+enum Side { UPPER = 0, LOWER = 1 };
+
+struct DynamicHull2D::Node {
+    Point pt;                       // leaf: the point; inner node: largest point below
+    size_t copies = 1;              // leaf only: how often pt was inserted
+    size_t leaves = 1;
+    std::unique_ptr<Node> left, right;
+    Point bridge[2][2];             // per side, the bridge endpoints in side coordinates
+
+    bool isLeaf() const { return !left; }
+};
+using Node = DynamicHull2D::Node;
+
+static inline bool lexLess(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+static inline bool samePoint(const Point& a, const Point& b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+static inline Point view(const Point& p, Side s) {
+    return s == UPPER ? p : Point{-p.x, -p.y};
+}
+
+// Children in increasing order of side coordinates
+static inline const Node* firstChild(const Node* u, Side s) {
+    return s == UPPER ? u->left.get() : u->right.get();
+}
+static inline const Node* secondChild(const Node* u, Side s) {
+    return s == UPPER ? u->right.get() : u->left.get();
+}
+
+// Part of a subtree's upper hull that is still on the hull of an ancestor: the
+// vertices between lo and hi (inclusive, nullptr = unbounded), in side coordinates
+struct Range {
+    const Point* lo = nullptr;
+    const Point* hi = nullptr;
+};
+
+// Walk the implicit upper hull of u restricted to r. At every inner node whose bridge
+// lies inside r the bridge is a real hull edge (a, b), and goRight(a, b) decides
+// whether the vertex searched for is at b or beyond (true) or at a or before (false).
+// Otherwise r lies in one child only and the walk just moves there.
+template <class GoRight>
+static Point findVertex(const Node* u, Side s, Range r, GoRight goRight) {
+    while (!u->isLeaf()) {
+        const Point& a = u->bridge[s][0];
+        const Point& b = u->bridge[s][1];
+        bool firstAlive = !r.lo || !lexLess(a, *r.lo);
+        bool secondAlive = !r.hi || !lexLess(*r.hi, b);
+        if (firstAlive && secondAlive) {
+            if (goRight(a, b)) { u = secondChild(u, s); r.lo = &b; }
+            else               { u = firstChild(u, s);  r.hi = &a; }
+        } else if (firstAlive) {
+            u = firstChild(u, s);
+            if (!r.hi || lexLess(a, *r.hi)) r.hi = &a;
+        } else {
+            u = secondChild(u, s);
+            if (!r.lo || lexLess(*r.lo, b)) r.lo = &b;
+        }
+    }
+    return view(u->pt, s);
+}
+
+// Bridge of the upper hulls of the two children. The left endpoint is the first
+// vertex p of the first hull whose outgoing edge has some point of the second subtree
+// on or above its line; the right endpoint is the tangent from p to the second hull.
+// Collinear runs resolve to their outermost points, as the strict monotone chain does.
+static void computeBridge(Node* u, Side s) {
+    const Node* L = firstChild(u, s);
+    const Node* R = secondChild(u, s);
+
+    // vertex of R's hull farthest to the left of line a->b
+    auto extremeOfR = [&](const Point& a, const Point& b) {
+        return findVertex(R, s, {}, [&](const Point& c, const Point& d) {
+            return orient2dDelta(a.x, a.y, b.x, b.y, d.x, d.y, c.x, c.y) > 0;
+        });
+    };
+
+    Point p = findVertex(L, s, {}, [&](const Point& a, const Point& b) {
+        return orientation(a, b, extremeOfR(a, b)) < 0;
+    });
+    Point q = findVertex(R, s, {}, [&](const Point& c, const Point& d) {
+        return orientation(p, c, d) >= 0;
+    });
+    u->bridge[s][0] = p;
+    u->bridge[s][1] = q;
+}
+
+static void pull(Node* u) {
+    u->leaves = u->left->leaves + u->right->leaves;
+    u->pt = u->right->pt;
+    computeBridge(u, UPPER);
+    computeBridge(u, LOWER);
+}
+
+static std::unique_ptr<Node> makeLeaf(const Point& p) {
+    auto leaf = std::make_unique<Node>();
+    leaf->pt = p;
+    return leaf;
+}
+
+static std::unique_ptr<Node> join(std::unique_ptr<Node> left, std::unique_ptr<Node> right) {
+    auto u = std::make_unique<Node>();
+    u->left = std::move(left);
+    u->right = std::move(right);
+    pull(u.get());
+    return u;
+}
+
+// ===== Weight balance =====
+// A subtree is rebuilt perfectly balanced once one child holds more than 70% of its
+// leaves, which keeps the depth O(log n) at O(log n) amortized rebuilt nodes per update.
+static bool unbalanced(const Node* u) {
+    size_t heavy = std::max(u->left->leaves, u->right->leaves);
+    return 10 * heavy > 7 * u->leaves;
+}
+
+static void collectLeaves(std::unique_ptr<Node> u, std::vector<std::unique_ptr<Node>>& out) {
+    if (u->isLeaf()) {
+        out.push_back(std::move(u));
+        return;
+    }
+    collectLeaves(std::move(u->left), out);
+    collectLeaves(std::move(u->right), out);
+}
+
+static std::unique_ptr<Node> buildBalanced(std::vector<std::unique_ptr<Node>>& leaves, size_t lo, size_t hi) {
+    if (hi - lo == 1) return std::move(leaves[lo]);
+    size_t mid = lo + (hi - lo) / 2;
+    auto left = buildBalanced(leaves, lo, mid);
+    auto right = buildBalanced(leaves, mid, hi);
+    return join(std::move(left), std::move(right));
+}
+
+static void rebalance(std::unique_ptr<Node>& u) {
+    if (u->isLeaf() || !unbalanced(u.get())) return;
+    std::vector<std::unique_ptr<Node>> leaves;
+    leaves.reserve(u->leaves);
+    collectLeaves(std::move(u), leaves);
+    u = buildBalanced(leaves, 0, leaves.size());
+}
+
+// ===== Updates =====
+// Both return whether the tree shape changed, i.e. whether bridges need recomputing.
+
+static bool insertRec(std::unique_ptr<Node>& u, const Point& p) {
+    if (u->isLeaf()) {
+        if (samePoint(u->pt, p)) {
+            u->copies++;
+            return false;
+        }
+        if (lexLess(p, u->pt)) u = join(makeLeaf(p), std::move(u));
+        else                   u = join(std::move(u), makeLeaf(p));
+        return true;
+    }
+
+    auto& child = lexLess(u->left->pt, p) ? u->right : u->left;
+    if (!insertRec(child, p)) return false;
+    pull(u.get());
+    rebalance(u);
+    return true;
+}
+
+enum class Erased { NotFound, Copy, Leaf };
+
+static Erased eraseRec(std::unique_ptr<Node>& u, const Point& p) {
+    bool goLeft = !lexLess(u->left->pt, p);
+    auto& child = goLeft ? u->left : u->right;
+
+    if (child->isLeaf()) {
+        if (!samePoint(child->pt, p)) return Erased::NotFound;
+        if (child->copies > 1) {
+            child->copies--;
+            return Erased::Copy;
+        }
+        // the sibling takes the place of this node
+        u = std::move(goLeft ? u->right : u->left);
+        return Erased::Leaf;
+    }
+
+    Erased result = eraseRec(child, p);
+    if (result == Erased::Leaf) {
+        pull(u.get());
+        rebalance(u);
+    }
+    return result;
+}
+
+DynamicHull2D::DynamicHull2D() = default;
+DynamicHull2D::~DynamicHull2D() = default;
+DynamicHull2D::DynamicHull2D(DynamicHull2D&&) noexcept = default;
+DynamicHull2D& DynamicHull2D::operator=(DynamicHull2D&&) noexcept = default;
+
+void DynamicHull2D::insert(const Point& p) {
+    count++;
+    if (!root) root = makeLeaf(p);
+    else insertRec(root, p);
+}
+
+bool DynamicHull2D::erase(const Point& p) {
+    if (!root) return false;
+    if (root->isLeaf()) {
+        if (!samePoint(root->pt, p)) return false;
+        if (--root->copies == 0) root.reset();
+        count--;
+        return true;
+    }
+    if (eraseRec(root, p) == Erased::NotFound) return false;
+    count--;
+    return true;
+}
+
+void DynamicHull2D::clear() {
+    root.reset();
+    count = 0;
+}
+
+// ===== Readout =====
+// Upper hull of u restricted to r, in increasing side coordinates
+static void collectHull(const Node* u, Side s, Range r, std::vector<Point>& out) {
+    if (u->isLeaf()) {
+        out.push_back(view(u->pt, s));
+        return;
+    }
+    const Point& a = u->bridge[s][0];
+    const Point& b = u->bridge[s][1];
+    if (!r.lo || !lexLess(a, *r.lo)) {
+        Range first = r;
+        if (!r.hi || lexLess(a, *r.hi)) first.hi = &a;
+        collectHull(firstChild(u, s), s, first, out);
+    }
+    if (!r.hi || !lexLess(*r.hi, b)) {
+        Range second = r;
+        if (!r.lo || lexLess(*r.lo, b)) second.lo = &b;
+        collectHull(secondChild(u, s), s, second, out);
+    }
+}
+
+// lower chain left to right, then the upper chain right to left without its two
+// ends (they close the lower chain), exactly as grahamHull emits them
+std::vector<Point> DynamicHull2D::hull() const {
+    if (!root) return {};
+
+    std::vector<Point> upper, lower;
+    collectHull(root.get(), UPPER, {}, upper);
+    collectHull(root.get(), LOWER, {}, lower);
+
+    std::vector<Point> out;
+    out.reserve(lower.size() + upper.size());
+    for (auto it = lower.rbegin(); it != lower.rend(); ++it) out.push_back(view(*it, LOWER));
+    if (upper.size() > 2) out.insert(out.end(), upper.rbegin() + 1, upper.rend() - 1);
+    return out;
+}
@@ -0,0 +1,68 @@
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <algorithm>
+#include "fork_join_pool.h"
+
+ForkJoinPool::ForkJoinPool(unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; i++) workers.emplace_back([this] { workerLoop(); });
+}
+
+ForkJoinPool::~ForkJoinPool() {
+    {
+        std::lock_guard<std::mutex> lock(m);
+        stopping = true;
+    }
+    cv.notify_all();
+    for (auto& w : workers) w.join();
+}
+
+void ForkJoinPool::fork(Group& group, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m);
+        group.pending++;
+        queue.push_back({std::move(task), &group});
+    }
+    cv.notify_one();
+}
+
+void ForkJoinPool::execute(Task task, std::unique_lock<std::mutex>& lock) {
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+        task.run();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    lock.lock();
+    if (error && !task.group->error) task.group->error = error;
+    // the joiner may be asleep waiting for this count to reach zero
+    if (--task.group->pending == 0) cv.notify_all();
+}
+
+void ForkJoinPool::join(Group& group) {
+    std::unique_lock<std::mutex> lock(m);
+    while (group.pending > 0) {
+        if (!queue.empty()) {
+            Task task = std::move(queue.back());
+            queue.pop_back();
+            execute(std::move(task), lock);
+        } else {
+            cv.wait(lock, [&] { return group.pending == 0 || !queue.empty(); });
+        }
+    }
+    if (group.error) std::rethrow_exception(group.error);
+}
+
+void ForkJoinPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(m);
+    while (true) {
+        cv.wait(lock, [&] { return stopping || !queue.empty(); });
+        if (queue.empty()) return;
+        Task task = std::move(queue.back());
+        queue.pop_back();
+        execute(std::move(task), lock);
+    }
+}
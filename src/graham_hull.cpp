@@ -2,40 +2,224 @@
 #include <algorithm>
 #include <stack>
 #include <cmath>
+#include <thread>
+#include <type_traits>
+#include <cstdint>
+#include <stdexcept>
 #include "draw.h"
 #include "point.h"
+#include "akl_toussaint.h"
+#include "radix_sort.h"
+#include "predicates.h"
+#include "point_view.h"
+#include "monotone_chain.h"
+#include "fork_join_pool.h"
+#include "graham_hull.h"
 
 
+// Sort points[0, n) by x, then by y. Double inputs from RADIX_SORT_THRESHOLD points up
+// take the radix sort, which ping-pongs through scratch[0, n).
+template <typename T>
+static void sortLexicographic(BasicPoint<T>* points, size_t n, BasicPoint<T>* scratch) {
+    if constexpr (std::is_same_v<T, double>) {
+        if (n >= RADIX_SORT_THRESHOLD) {
+            radixSortPoints(points, scratch, n);
+            return;
+        }
+    }
+    std::sort(points, points + n, [](const BasicPoint<T> &a, const BasicPoint<T> &b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+}
+
+// Same over a vector; the caller's scratch only grows when the radix sort needs it
+template <typename T>
+static void sortLexicographic(std::vector<BasicPoint<T>>& points, std::vector<BasicPoint<T>>& scratch) {
+    if (std::is_same_v<T, double> && points.size() >= RADIX_SORT_THRESHOLD && scratch.size() < points.size())
+        scratch.resize(points.size());
+    sortLexicographic(points.data(), points.size(), scratch.data());
+}
+
+template <typename T>
+static std::vector<BasicPoint<T>> monotoneChain(const std::vector<BasicPoint<T>>& points) {
+    return monotoneChain(points, [](const BasicPoint<T>& p) -> const BasicPoint<T>& { return p; });
+}
+
 // Graham Scan Convex Hull
-std::vector<Point> grahamHull(std::vector<Point> points) {
-    int n = points.size();
-    if (n <= 1) return points;
+template <typename T>
+std::vector<BasicPoint<T>> grahamHull(std::vector<BasicPoint<T>> points) {
+    if (points.size() <= 1) return points;
+    std::vector<BasicPoint<T>> scratch;
+    sortLexicographic(points, scratch);
+    return monotoneChain(points);
+}
 
-    // Sort points by x, then by y
-    std::sort(points.begin(), points.end(), [](const Point &a, const Point &b) {
-        return a.x < b.x || (a.x == b.x && a.y < b.y);
+// Compile-time dispatch: one instantiation per coordinate kernel
+template std::vector<PointF> grahamHull<float>(std::vector<PointF>);
+template std::vector<Point> grahamHull<double>(std::vector<Point>);
+template std::vector<PointI> grahamHull<int64_t>(std::vector<PointI>);
+
+// Graham Scan with optional Akl–Toussaint prefilter
+std::vector<Point> grahamHull(std::vector<Point> points, bool prefilter, size_t* removed) {
+    size_t dropped = prefilter ? aklToussaintFilter(points) : 0;
+    if (removed) *removed = dropped;
+    return grahamHull(std::move(points));
+}
+
+// Graham Scan over a point view: only the points outside the Akl–Toussaint polygon
+// are copied into scratch.points, which is all the sort ever sees
+size_t grahamHull(const PointView& in, Point* out, size_t capacity, GrahamScratch& scratch) {
+    Point poly[8];
+    size_t m = aklToussaintPolygon(in, poly);
+    auto& pts = scratch.points;
+    pts.clear();
+    for (size_t i = 0; i < in.size(); i++) {
+        Point p = in[i];
+        if (m == 0 || !aklToussaintInside(poly, m, p)) pts.push_back(p);
+    }
+
+    std::vector<Point> hull;
+    if (pts.size() <= 1) {
+        hull = pts;
+    } else {
+        sortLexicographic(pts, scratch.sort);
+        hull = monotoneChain(pts);
+    }
+    std::copy_n(hull.begin(), std::min(hull.size(), capacity), out);
+    return hull.size();
+}
+
+// Graham Scan returning indices: sorts 4-byte indices of the points outside the
+// Akl–Toussaint polygon, never the points themselves
+std::vector<uint32_t> grahamHullIndices(const PointView& in) {
+    if (in.size() > UINT32_MAX) throw std::length_error("grahamHullIndices: more than 2^32 - 1 points");
+    Point poly[8];
+    size_t m = aklToussaintPolygon(in, poly);
+    std::vector<uint32_t> order;
+    for (size_t i = 0; i < in.size(); i++) {
+        if (m == 0 || !aklToussaintInside(poly, m, in[i])) order.push_back((uint32_t)i);
+    }
+    if (order.size() <= 1) return order;
+
+    // ties between equal points go to the smaller index, so the result is deterministic
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        Point p = in[a], q = in[b];
+        return p.x < q.x || (p.x == q.x && (p.y < q.y || (p.y == q.y && a < b)));
     });
+    return monotoneChain(order, [&](uint32_t i) { return in[i]; });
+}
+
+// Push p onto a monotone chain, popping every vertex that stops being a strict left turn
+static inline void pushChain(std::vector<Point>& chain, const Point& p) {
+    while (chain.size() >= 2 && orientation(chain[chain.size()-2], chain.back(), p) <= 0) chain.pop_back();
+    chain.push_back(p);
+}
+
+// Lower chain runs left to right, upper chain right to left, as in grahamHull
+struct SlabHull {
+    std::vector<Point> lower, upper;
+};
+
+// Merge the hull of a slab with the hull of the slab to its right. Feeding one chain's
+// vertices through the other's stack pops exactly the vertices left of the bridge,
+// so each merge is O(h) and yields the chain the serial scan would build.
+static SlabHull mergeSlabs(const SlabHull& left, const SlabHull& right) {
+    SlabHull merged;
+    merged.lower.reserve(left.lower.size() + right.lower.size());
+    merged.lower = left.lower;
+    for (auto& p : right.lower) pushChain(merged.lower, p);
+
+    merged.upper.reserve(left.upper.size() + right.upper.size());
+    merged.upper = right.upper;
+    for (auto& p : left.upper) pushChain(merged.upper, p);
+    return merged;
+}
+
+// Parallel Graham Scan (monotone chain)
+std::vector<Point> grahamHullParallel(std::vector<Point> points, unsigned threads, size_t cutoff) {
+    const size_t n = points.size();
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t slabs = std::min<size_t>(threads, n / std::max<size_t>(cutoff, 1));
+    if (slabs < 2) return grahamHull(std::move(points));
 
+    // one pool for every phase: its threads are started once per call
+    ForkJoinPool pool((unsigned)slabs);
 
-    std::vector<Point> hull(2*n);
-    int k = 0;
+    auto byXY = [](const Point &a, const Point &b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    };
+
+    // 1) parallel sample sort: splitters drawn from a regular sample cut the points into
+    // one bucket per slab, in (x, y) order. Each thread counts its chunk's points per
+    // bucket, a prefix sum over chunks gives every thread its own ranges in each bucket,
+    // and the buckets are filled and then sorted independently: no merge pass, and no
+    // step that runs on one thread over all n points. Ties land in one bucket.
+    const size_t oversample = 64;
+    std::vector<Point> sample(slabs * oversample);
+    for (size_t i = 0; i < sample.size(); i++) sample[i] = points[n * i / sample.size()];
+    std::sort(sample.begin(), sample.end(), byXY);
+    std::vector<Point> splitters(slabs - 1);
+    for (size_t b = 1; b < slabs; b++) splitters[b-1] = sample[b * oversample];
+    auto bucketOf = [&](const Point& p) {
+        return std::upper_bound(splitters.begin(), splitters.end(), p, byXY) - splitters.begin();
+    };
 
-    // Build lower hull
-    for (int i = 0; i < n; ++i) {
-        
-        while (k >= 2 && cross(hull[k-2], hull[k-1], points[i]) <= 0) {
-            k--;
+    // next[t][b]: where chunk t writes its next point of bucket b
+    std::vector<size_t> chunks(slabs + 1);
+    for (size_t i = 0; i <= slabs; i++) chunks[i] = n * i / slabs;
+    std::vector<std::vector<size_t>> next(slabs, std::vector<size_t>(slabs, 0));
+    pool.parallelFor(slabs, [&](size_t t) {
+        for (size_t j = chunks[t]; j < chunks[t+1]; j++) next[t][bucketOf(points[j])]++;
+    });
+    std::vector<std::vector<Point>> buckets(slabs);
+    for (size_t b = 0; b < slabs; b++) {
+        size_t size = 0;
+        for (size_t t = 0; t < slabs; t++) {
+            size_t count = next[t][b];
+            next[t][b] = size;
+            size += count;
         }
-        hull[k++] = points[i];
+        buckets[b].resize(size);
     }
+    pool.parallelFor(slabs, [&](size_t t) {
+        for (size_t j = chunks[t]; j < chunks[t+1]; j++) {
+            size_t b = bucketOf(points[j]);
+            buckets[b][next[t][b]++] = points[j];
+        }
+    });
+    // the buckets hold every point now: each bucket's sort takes its own range of
+    // `points` as scratch, so the workers share one buffer and allocate nothing
+    std::vector<size_t> bucketStart(slabs + 1, 0);
+    for (size_t b = 0; b < slabs; b++) bucketStart[b+1] = bucketStart[b] + buckets[b].size();
+    pool.parallelFor(slabs, [&](size_t b) {
+        sortLexicographic(buckets[b].data(), buckets[b].size(), points.data() + bucketStart[b]);
+    });
+    std::vector<Point>().swap(points);
 
+    // 2) hulls of contiguous x-slabs, concurrently
+    std::vector<SlabHull> hulls(slabs);
+    pool.parallelFor(slabs, [&](size_t i) {
+        auto& h = hulls[i];
+        const auto& slab = buckets[i];
+        for (size_t j = 0; j < slab.size(); j++) pushChain(h.lower, slab[j]);
+        for (size_t j = slab.size(); j-- > 0; ) pushChain(h.upper, slab[j]);
+    });
 
-    // Build upper hull
-    for (int i = n-2, t = k+1; i >= 0; --i) {
-        while (k >= t && cross(hull[k-2], hull[k-1], points[i]) <= 0) k--;
-        hull[k++] = points[i];
+    // 3) merge neighbouring slab hulls pairwise, level by level
+    while (hulls.size() > 1) {
+        std::vector<SlabHull> next((hulls.size() + 1) / 2);
+        pool.parallelFor(hulls.size() / 2, [&](size_t k) {
+            next[k] = mergeSlabs(hulls[2*k], hulls[2*k + 1]);
+        });
+        if (hulls.size() % 2) next.back() = std::move(hulls.back());
+        hulls.swap(next);
     }
 
-    hull.resize(k-1);
+    // lower chain, then the upper chain without its first vertex (the last lower one)
+    // and without its last vertex (the first lower one), exactly as grahamHull emits them
+    const auto& lower = hulls[0].lower;
+    const auto& upper = hulls[0].upper;
+    std::vector<Point> hull(lower);
+    hull.insert(hull.end(), upper.begin() + 1, upper.end() - 1);
     return hull;
-}
\ No newline at end of file
+}
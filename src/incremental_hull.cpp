@@ -0,0 +1,73 @@
+#include <vector>
+#include <set>
+#include <iterator>
+#include "point.h"
+#include "predicates.h"
+#include "incremental_hull.h"
+
+static inline Point rotated(const Point& p) {
+    return {-p.x, -p.y};
+}
+
+// p changes the chain only if it lies beyond one of its ends or strictly below the
+// edge between its lexicographic neighbours
+bool IncrementalHull2D::Chain::covers(const Point& p) const {
+    if (pts.empty()) return false;
+    auto next = pts.lower_bound(p);
+    if (next != pts.end() && next->x == p.x && next->y == p.y) return true;
+    if (next == pts.begin() || next == pts.end()) return false;
+    return orientation(*std::prev(next), p, *next) <= 0;
+}
+
+bool IncrementalHull2D::Chain::insert(const Point& p) {
+    if (covers(p)) return false;
+    auto it = pts.insert(p).first;
+
+    // successors that stop being strict left turns
+    auto next = std::next(it);
+    while (next != pts.end()) {
+        auto after = std::next(next);
+        if (after == pts.end() || orientation(p, *next, *after) > 0) break;
+        next = pts.erase(next);
+    }
+
+    // predecessors, symmetrically
+    while (it != pts.begin()) {
+        auto prev = std::prev(it);
+        if (prev == pts.begin() || orientation(*std::prev(prev), *prev, p) > 0) break;
+        pts.erase(prev);
+    }
+    return true;
+}
+
+bool IncrementalHull2D::insert(const Point& p) {
+    bool changedLower = lower.insert(p);
+    bool changedUpper = upper.insert(rotated(p));
+    return changedLower || changedUpper;
+}
+
+bool IncrementalHull2D::contains(const Point& p) const {
+    return lower.covers(p) && upper.covers(rotated(p));
+}
+
+// lower chain, then the upper chain without its first vertex (the last lower one)
+// and without its last vertex (the first lower one), exactly as grahamHull emits them
+std::vector<Point> IncrementalHull2D::hull() const {
+    std::vector<Point> out(lower.pts.begin(), lower.pts.end());
+    if (out.size() < 2) return out;
+
+    out.reserve(size());
+    auto first = std::next(upper.pts.begin()), last = std::prev(upper.pts.end());
+    for (auto it = first; it != last; ++it) out.push_back(rotated(*it));
+    return out;
+}
+
+size_t IncrementalHull2D::size() const {
+    if (lower.pts.size() < 2) return lower.pts.size();
+    return lower.pts.size() + upper.pts.size() - 2;
+}
+
+void IncrementalHull2D::clear() {
+    lower.pts.clear();
+    upper.pts.clear();
+}
@@ -4,8 +4,7 @@
 #include "quick_hull_3d.h"
 #include "draw3d.h"
 
-
-// Demo usage
+// Demo usage (headless point-file hulls: see cli.cpp)
 int main() {
     //-----------------quick hulll 2D------------
 
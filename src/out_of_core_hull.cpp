@@ -0,0 +1,187 @@
+#include <vector>
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "point.h"
+#include "point_view.h"
+#include "point_file.h"
+#include "graham_hull.h"
+#include "out_of_core_hull.h"
+
+// Chunk hulls are re-hulled once they hold this many points (or twice the last
+// reduced hull, whichever is larger), which bounds the merge buffer by the hull size
+static const size_t MERGE_THRESHOLD = 1 << 16;
+
+// One chunk of raw records
+struct Chunk {
+    std::vector<char> bytes;
+    size_t count = 0;
+};
+
+// Two-slot hand-off between the reader thread and the hull thread: the reader fills
+// a free chunk while the hull thread works on the other one
+class ChunkPipe {
+public:
+    ChunkPipe() { freeList = {&slots[0], &slots[1]}; }
+
+    // Reader side: a chunk to fill, or nullptr once the consumer has given up
+    Chunk* acquireFree() {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&] { return !freeList.empty() || stopped; });
+        if (stopped) return nullptr;
+        Chunk* c = freeList.back();
+        freeList.pop_back();
+        return c;
+    }
+    void publish(Chunk* c) {
+        std::lock_guard<std::mutex> lock(m);
+        fullList.push_back(c);
+        cv.notify_all();
+    }
+    void finish(std::exception_ptr e = nullptr) {
+        std::lock_guard<std::mutex> lock(m);
+        done = true;
+        error = e;
+        cv.notify_all();
+    }
+
+    // Hull side: the next chunk in file order, or nullptr at the end of the file
+    Chunk* acquireFull() {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&] { return !fullList.empty() || done; });
+        if (fullList.empty()) {
+            if (error) std::rethrow_exception(error);
+            return nullptr;
+        }
+        Chunk* c = fullList.front();
+        fullList.erase(fullList.begin());
+        return c;
+    }
+    void recycle(Chunk* c) {
+        std::lock_guard<std::mutex> lock(m);
+        freeList.push_back(c);
+        cv.notify_all();
+    }
+    void stop() {
+        std::lock_guard<std::mutex> lock(m);
+        stopped = true;
+        cv.notify_all();
+    }
+
+private:
+    Chunk slots[2];
+    std::mutex m;
+    std::condition_variable cv;
+    std::vector<Chunk*> freeList, fullList;
+    bool done = false, stopped = false;
+    std::exception_ptr error;
+};
+
+// pread exactly `bytes` bytes at `offset`
+static void readFully(int fd, char* dst, size_t bytes, off_t offset, const std::string& path) {
+    while (bytes > 0) {
+        ssize_t got = pread(fd, dst, bytes, offset);
+        if (got < 0 && errno == EINTR) continue;
+        if (got < 0) throw std::runtime_error(path + ": " + std::strerror(errno));
+        if (got == 0) throw std::runtime_error(path + ": unexpected end of file");
+        dst += got;
+        bytes -= got;
+        offset += got;
+    }
+}
+
+// Reader thread body: streams the records into the pipe in chunkPoints pieces
+static void readChunks(int fd, const PointFileHeader& header, size_t chunkPoints,
+                       const std::string& path, ChunkPipe& pipe) {
+    try {
+        const size_t record = 2 * header.scalarBytes;
+        for (size_t first = 0; first < header.count; first += chunkPoints) {
+            Chunk* c = pipe.acquireFree();
+            if (!c) break;
+            c->count = std::min<size_t>(chunkPoints, header.count - first);
+            c->bytes.resize(c->count * record);
+            readFully(fd, c->bytes.data(), c->bytes.size(), header.dataOffset + first * record, path);
+            pipe.publish(c);
+        }
+        pipe.finish();
+    } catch (...) {
+        pipe.finish(std::current_exception());
+    }
+}
+
+std::vector<Point> outOfCoreHull(const std::string& path, size_t chunkPoints, size_t* chunks) {
+    if (chunkPoints == 0) throw std::invalid_argument("outOfCoreHull: chunkPoints must be positive");
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error(path + ": " + std::strerror(errno));
+    // one sequential pass over the records; the page cache need not keep them
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    PointFileHeader header{};
+    struct stat st;
+    try {
+        if (fstat(fd, &st) != 0) throw std::runtime_error(path + ": " + std::strerror(errno));
+        if ((size_t)st.st_size < sizeof(header))
+            throw std::runtime_error(path + ": too short for a point file header");
+        readFully(fd, reinterpret_cast<char*>(&header), sizeof(header), 0, path);
+        checkPointFileHeader(header, st.st_size, path);
+        if (header.dim != 2) throw std::runtime_error(path + ": outOfCoreHull needs a 2D point file");
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+
+    ChunkPipe pipe;
+    std::thread reader(readChunks, fd, std::cref(header), chunkPoints, std::cref(path), std::ref(pipe));
+
+    std::vector<Point> merged, widened, out;
+    GrahamScratch scratch;
+    size_t reduced = 0, count = 0;
+    try {
+        while (Chunk* c = pipe.acquireFull()) {
+            // double records already have Point layout; float ones are widened first
+            PointView view;
+            if (header.scalarBytes == sizeof(double)) {
+                view = pointSpan(reinterpret_cast<const Point*>(c->bytes.data()), c->count);
+            } else {
+                const float* xy = reinterpret_cast<const float*>(c->bytes.data());
+                widened.resize(c->count);
+                for (size_t i = 0; i < c->count; i++) widened[i] = {xy[2 * i], xy[2 * i + 1]};
+                view = pointSpan(widened);
+            }
+
+            size_t h = grahamHull(view, out.data(), out.size(), scratch);
+            if (h > out.size()) {
+                out.resize(h);
+                grahamHull(view, out.data(), out.size(), scratch);
+            }
+            pipe.recycle(c);
+            count++;
+
+            merged.insert(merged.end(), out.begin(), out.begin() + h);
+            if (merged.size() > std::max(MERGE_THRESHOLD, 2 * reduced)) {
+                merged = grahamHull(std::move(merged));
+                reduced = merged.size();
+            }
+        }
+    } catch (...) {
+        pipe.stop();
+        reader.join();
+        ::close(fd);
+        throw;
+    }
+    reader.join();
+    ::close(fd);
+
+    if (chunks) *chunks = count;
+    return grahamHull(std::move(merged));
+}
@@ -0,0 +1,152 @@
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "point_file.h"
+
+static const char POINT_FILE_MAGIC[4] = {'C', 'H', 'P', 'T'};
+static const uint16_t POINT_FILE_VERSION = 1;
+
+static std::runtime_error fileError(const std::string& path, const std::string& what) {
+    return std::runtime_error(path + ": " + what);
+}
+
+void checkPointFileHeader(const PointFileHeader& header, uint64_t fileSize, const std::string& path) {
+    const char* problem = nullptr;
+    if (std::memcmp(header.magic, POINT_FILE_MAGIC, 4) != 0) problem = "not a point file (bad magic)";
+    else if (header.version != POINT_FILE_VERSION) problem = "unsupported point file version";
+    else if (header.dim != 2 && header.dim != 3) problem = "dimension must be 2 or 3";
+    else if (header.scalarBytes != 4 && header.scalarBytes != 8) problem = "scalars must be 4 or 8 bytes";
+    else if (header.dataOffset < sizeof(PointFileHeader) || header.dataOffset % 8 != 0)
+        problem = "misaligned record offset";
+    else if (header.dataOffset > fileSize ||
+             header.count > (fileSize - header.dataOffset) / (header.dim * header.scalarBytes))
+        problem = "file is shorter than its header claims";
+    if (problem) throw fileError(path, problem);
+}
+
+MappedPointFile::MappedPointFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw fileError(path, std::strerror(errno));
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        throw fileError(path, std::strerror(err));
+    }
+    length = st.st_size;
+    if (length < sizeof(PointFileHeader)) {
+        ::close(fd);
+        throw fileError(path, "too short for a point file header");
+    }
+
+    base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    ::close(fd);        // the mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        base = nullptr;
+        throw fileError(path, std::strerror(err));
+    }
+    // every engine streams over the records front to back
+    madvise(base, length, MADV_SEQUENTIAL);
+
+    std::memcpy(&header, base, sizeof(header));
+    try {
+        checkPointFileHeader(header, length, path);
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+MappedPointFile::~MappedPointFile() {
+    release();
+}
+
+MappedPointFile::MappedPointFile(MappedPointFile&& other) noexcept
+    : base(other.base), length(other.length), header(other.header), widened(std::move(other.widened)) {
+    other.base = nullptr;
+    other.length = 0;
+}
+
+MappedPointFile& MappedPointFile::operator=(MappedPointFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        base = other.base;
+        length = other.length;
+        header = other.header;
+        widened = std::move(other.widened);
+        other.base = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+void MappedPointFile::release() {
+    if (base) munmap(base, length);
+    base = nullptr;
+    length = 0;
+}
+
+void MappedPointFile::widen() {
+    if (header.scalarBytes == sizeof(double) || !widened.empty()) return;
+    size_t total = header.count * header.dim;
+    const float* src = reinterpret_cast<const float*>(records());
+    widened.resize(total);
+    for (size_t i = 0; i < total; i++) widened[i] = src[i];
+}
+
+PointView MappedPointFile::view2D() {
+    if (header.dim != 2) throw std::runtime_error("view2D on a 3D point file");
+    widen();
+    const double* xy = widened.empty() ? reinterpret_cast<const double*>(records()) : widened.data();
+    return pointStrided(xy, xy + 1, header.count, 2 * sizeof(double));
+}
+
+qh3d::PointView3D MappedPointFile::view3D() {
+    if (header.dim != 3) throw std::runtime_error("view3D on a 2D point file");
+    widen();
+    const double* xyz = widened.empty() ? reinterpret_cast<const double*>(records()) : widened.data();
+    return {xyz, xyz + 1, xyz + 2, header.count, 3 * sizeof(double)};
+}
+
+// fwrite the whole buffer or throw
+static void writeAll(std::FILE* f, const std::string& path, const void* data, size_t bytes) {
+    if (bytes != 0 && std::fwrite(data, 1, bytes, f) != bytes) {
+        std::fclose(f);
+        throw fileError(path, "write failed");
+    }
+}
+
+void writePointFile(const std::string& path, int dim, int scalarBytes, const void* coords, size_t count) {
+    if ((dim != 2 && dim != 3) || (scalarBytes != 4 && scalarBytes != 8))
+        throw fileError(path, "unsupported point layout");
+
+    PointFileHeader header{};
+    std::memcpy(header.magic, POINT_FILE_MAGIC, 4);
+    header.version = POINT_FILE_VERSION;
+    header.dim = dim;
+    header.scalarBytes = scalarBytes;
+    header.count = count;
+    header.dataOffset = sizeof(PointFileHeader);
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) throw fileError(path, std::strerror(errno));
+    writeAll(f, path, &header, sizeof(header));
+    writeAll(f, path, coords, count * dim * scalarBytes);
+    if (std::fclose(f) != 0) throw fileError(path, "write failed");
+}
+
+void writeIndexFile(const std::string& path, const uint32_t* indices, size_t count) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) throw fileError(path, std::strerror(errno));
+    writeAll(f, path, indices, count * sizeof(uint32_t));
+    if (std::fclose(f) != 0) throw fileError(path, "write failed");
+}
@@ -0,0 +1,444 @@
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include "point.h"
+#include "point_soa.h"
+
+// The AVX2 and AVX-512 kernels are compiled in every build through per-function target
+// attributes, whatever -march says, and chosen at run time from what the CPU supports
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SOA_X86 1
+#include <immintrin.h>
+#define SOA_AVX2 __attribute__((target("avx2")))
+#define SOA_AVX512 __attribute__((target("avx512f")))
+#endif
+
+PointsSoA::PointsSoA(const std::vector<Point>& pts) {
+    x.reserve(pts.size());
+    y.reserve(pts.size());
+    for (auto& p : pts) push_back(p);
+}
+
+// ===== Kernel selection =====
+static bool cpuHas(SoaKernelIsa isa) {
+#if defined(SOA_X86)
+    __builtin_cpu_init();
+    if (isa == SoaKernelIsa::AVX512) return __builtin_cpu_supports("avx512f");
+    if (isa == SoaKernelIsa::AVX2) return __builtin_cpu_supports("avx2");
+#endif
+    return isa == SoaKernelIsa::Scalar;
+}
+
+static std::atomic<SoaKernelIsa>& activeIsa() {
+    static std::atomic<SoaKernelIsa> isa{cpuHas(SoaKernelIsa::AVX512) ? SoaKernelIsa::AVX512
+                                       : cpuHas(SoaKernelIsa::AVX2) ? SoaKernelIsa::AVX2
+                                       : SoaKernelIsa::Scalar};
+    return isa;
+}
+
+SoaKernelIsa soaKernelIsa() {
+    return activeIsa().load(std::memory_order_relaxed);
+}
+
+bool setSoaKernelIsa(SoaKernelIsa isa) {
+    if (!cpuHas(isa)) return false;
+    activeIsa().store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+// cross(A, B, p) with the same operand order as cross() in point.h
+static inline double crossAt(double ax, double ay, double dx, double dy, double px, double py) {
+    return dx * (py - ay) - dy * (px - ax);
+}
+
+// ===== Leftmost and rightmost points =====
+// points [i, n), after the vector loop (if any) covered [0, i)
+static void extremesTail(const double* x, size_t i, size_t n, size_t& iMin, size_t& iMax) {
+    for (; i < n; i++) {
+        if (x[i] < x[iMin]) iMin = i;
+        if (x[i] >= x[iMax]) iMax = i;
+    }
+}
+
+#if defined(SOA_X86)
+// each lane kept its first minimum and last maximum; across lanes the smaller index
+// wins ties for the minimum and the larger one for the maximum
+static void mergeExtremeLanes(const double* x, size_t W,
+                              const double* laneMin, const double* laneMinIdx,
+                              const double* laneMax, const double* laneMaxIdx,
+                              size_t& iMin, size_t& iMax) {
+    for (size_t l = 0; l < W; l++) {
+        if (laneMinIdx[l] >= 0) {
+            size_t li = (size_t)laneMinIdx[l];
+            if (laneMin[l] < x[iMin] || (laneMin[l] == x[iMin] && li < iMin)) iMin = li;
+        }
+        if (laneMaxIdx[l] >= 0) {
+            size_t li = (size_t)laneMaxIdx[l];
+            if (laneMax[l] > x[iMax] || (laneMax[l] == x[iMax] && li > iMax)) iMax = li;
+        }
+    }
+}
+
+SOA_AVX512 static void extremesAVX512(const double* x, size_t n, size_t& iMin, size_t& iMax) {
+    iMin = iMax = 0;
+    size_t i = 0;
+    constexpr size_t W = 8;
+    alignas(64) double laneMin[W], laneMinIdx[W], laneMax[W], laneMaxIdx[W];
+    if (n >= W) {
+        const __m512d step = _mm512_set1_pd((double)W);
+        __m512d vmin = _mm512_set1_pd(HUGE_VAL), vminIdx = _mm512_set1_pd(-1.0);
+        __m512d vmax = _mm512_set1_pd(-HUGE_VAL), vmaxIdx = _mm512_set1_pd(-1.0);
+        __m512d vidx = _mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0);
+        for (; i + W <= n; i += W) {
+            __m512d px = _mm512_loadu_pd(x + i);
+            __mmask8 lt = _mm512_cmp_pd_mask(px, vmin, _CMP_LT_OQ);
+            __mmask8 ge = _mm512_cmp_pd_mask(px, vmax, _CMP_GE_OQ);
+            vmin = _mm512_mask_blend_pd(lt, vmin, px);
+            vminIdx = _mm512_mask_blend_pd(lt, vminIdx, vidx);
+            vmax = _mm512_mask_blend_pd(ge, vmax, px);
+            vmaxIdx = _mm512_mask_blend_pd(ge, vmaxIdx, vidx);
+            vidx = _mm512_add_pd(vidx, step);
+        }
+        _mm512_store_pd(laneMin, vmin);
+        _mm512_store_pd(laneMinIdx, vminIdx);
+        _mm512_store_pd(laneMax, vmax);
+        _mm512_store_pd(laneMaxIdx, vmaxIdx);
+        mergeExtremeLanes(x, W, laneMin, laneMinIdx, laneMax, laneMaxIdx, iMin, iMax);
+    }
+    extremesTail(x, i, n, iMin, iMax);
+}
+
+SOA_AVX2 static void extremesAVX2(const double* x, size_t n, size_t& iMin, size_t& iMax) {
+    iMin = iMax = 0;
+    size_t i = 0;
+    constexpr size_t W = 4;
+    alignas(32) double laneMin[W], laneMinIdx[W], laneMax[W], laneMaxIdx[W];
+    if (n >= W) {
+        const __m256d step = _mm256_set1_pd((double)W);
+        __m256d vmin = _mm256_set1_pd(HUGE_VAL), vminIdx = _mm256_set1_pd(-1.0);
+        __m256d vmax = _mm256_set1_pd(-HUGE_VAL), vmaxIdx = _mm256_set1_pd(-1.0);
+        __m256d vidx = _mm256_set_pd(3, 2, 1, 0);
+        for (; i + W <= n; i += W) {
+            __m256d px = _mm256_loadu_pd(x + i);
+            __m256d lt = _mm256_cmp_pd(px, vmin, _CMP_LT_OQ);
+            __m256d ge = _mm256_cmp_pd(px, vmax, _CMP_GE_OQ);
+            vmin = _mm256_blendv_pd(vmin, px, lt);
+            vminIdx = _mm256_blendv_pd(vminIdx, vidx, lt);
+            vmax = _mm256_blendv_pd(vmax, px, ge);
+            vmaxIdx = _mm256_blendv_pd(vmaxIdx, vidx, ge);
+            vidx = _mm256_add_pd(vidx, step);
+        }
+        _mm256_store_pd(laneMin, vmin);
+        _mm256_store_pd(laneMinIdx, vminIdx);
+        _mm256_store_pd(laneMax, vmax);
+        _mm256_store_pd(laneMaxIdx, vmaxIdx);
+        mergeExtremeLanes(x, W, laneMin, laneMinIdx, laneMax, laneMaxIdx, iMin, iMax);
+    }
+    extremesTail(x, i, n, iMin, iMax);
+}
+#endif
+
+void soaExtremesX(const double* x, size_t n, size_t& iMin, size_t& iMax) {
+#if defined(SOA_X86)
+    switch (soaKernelIsa()) {
+    case SoaKernelIsa::AVX512: return extremesAVX512(x, n, iMin, iMax);
+    case SoaKernelIsa::AVX2: return extremesAVX2(x, n, iMin, iMax);
+    case SoaKernelIsa::Scalar: break;
+    }
+#endif
+    iMin = iMax = 0;
+    extremesTail(x, 0, n, iMin, iMax);
+}
+
+// ===== Max signed area over one side =====
+static void farthestTail(const double* x, const double* y, size_t i, size_t n,
+                         const Point& A, double dx, double dy, double& best, size_t& bestIdx) {
+    for (; i < n; i++) {
+        double c = crossAt(A.x, A.y, dx, dy, x[i], y[i]);
+        if (c > best) { best = c; bestIdx = i; }
+    }
+}
+
+#if defined(SOA_X86)
+// each lane kept its earliest maximum; across lanes the smaller index wins ties
+static void mergeBestLanes(size_t W, const double* laneBest, const double* laneIdx,
+                           double& best, size_t& bestIdx) {
+    for (size_t l = 0; l < W; l++) {
+        if (laneIdx[l] < 0) continue;
+        size_t li = (size_t)laneIdx[l];
+        if (laneBest[l] > best || (laneBest[l] == best && li < bestIdx)) {
+            best = laneBest[l];
+            bestIdx = li;
+        }
+    }
+}
+
+// cross(A, B, p) for the 8 points from `at`
+SOA_AVX512 static inline __m512d crossAt8(const double* x, const double* y, size_t at,
+                                     __m512d vax, __m512d vay, __m512d vdx, __m512d vdy) {
+    __m512d px = _mm512_loadu_pd(x + at), py = _mm512_loadu_pd(y + at);
+    return _mm512_sub_pd(_mm512_mul_pd(vdx, _mm512_sub_pd(py, vay)),
+                         _mm512_mul_pd(vdy, _mm512_sub_pd(px, vax)));
+}
+
+// Two accumulators, each over every other vector: one compare-and-blend chain alone is
+// latency bound
+SOA_AVX512 static size_t farthestAVX512(const double* x, const double* y, size_t n,
+                                        const Point& A, const Point& B, double minArea) {
+    const double dx = B.x - A.x, dy = B.y - A.y;
+    double best = minArea;
+    size_t bestIdx = n;
+    size_t i = 0;
+    constexpr size_t W = 8;
+    const __m512d vax = _mm512_set1_pd(A.x), vay = _mm512_set1_pd(A.y);
+    const __m512d vdx = _mm512_set1_pd(dx), vdy = _mm512_set1_pd(dy);
+    const __m512d step = _mm512_set1_pd((double)(2 * W));
+    __m512d vbest0 = _mm512_set1_pd(minArea), vbestIdx0 = _mm512_set1_pd(-1.0);
+    __m512d vbest1 = vbest0, vbestIdx1 = vbestIdx0;
+    __m512d vidx0 = _mm512_set_pd(7, 6, 5, 4, 3, 2, 1, 0);
+    __m512d vidx1 = _mm512_set_pd(15, 14, 13, 12, 11, 10, 9, 8);
+    for (; i + 2 * W <= n; i += 2 * W) {
+        __m512d c0 = crossAt8(x, y, i, vax, vay, vdx, vdy);
+        __m512d c1 = crossAt8(x, y, i + W, vax, vay, vdx, vdy);
+        __mmask8 gt0 = _mm512_cmp_pd_mask(c0, vbest0, _CMP_GT_OQ);
+        __mmask8 gt1 = _mm512_cmp_pd_mask(c1, vbest1, _CMP_GT_OQ);
+        vbest0 = _mm512_mask_blend_pd(gt0, vbest0, c0);
+        vbestIdx0 = _mm512_mask_blend_pd(gt0, vbestIdx0, vidx0);
+        vbest1 = _mm512_mask_blend_pd(gt1, vbest1, c1);
+        vbestIdx1 = _mm512_mask_blend_pd(gt1, vbestIdx1, vidx1);
+        vidx0 = _mm512_add_pd(vidx0, step);
+        vidx1 = _mm512_add_pd(vidx1, step);
+    }
+    if (i + W <= n) {
+        __m512d c0 = crossAt8(x, y, i, vax, vay, vdx, vdy);
+        __mmask8 gt0 = _mm512_cmp_pd_mask(c0, vbest0, _CMP_GT_OQ);
+        vbest0 = _mm512_mask_blend_pd(gt0, vbest0, c0);
+        vbestIdx0 = _mm512_mask_blend_pd(gt0, vbestIdx0, vidx0);
+        i += W;
+    }
+    // lane by lane, the larger area wins, then the smaller index
+    __mmask8 take1 = _mm512_cmp_pd_mask(vbest1, vbest0, _CMP_GT_OQ) |
+                     (_mm512_cmp_pd_mask(vbest1, vbest0, _CMP_EQ_OQ) &
+                      _mm512_cmp_pd_mask(vbestIdx1, vbestIdx0, _CMP_LT_OQ));
+    alignas(64) double laneBest[W], laneIdx[W];
+    _mm512_store_pd(laneBest, _mm512_mask_blend_pd(take1, vbest0, vbest1));
+    _mm512_store_pd(laneIdx, _mm512_mask_blend_pd(take1, vbestIdx0, vbestIdx1));
+    mergeBestLanes(W, laneBest, laneIdx, best, bestIdx);
+    farthestTail(x, y, i, n, A, dx, dy, best, bestIdx);
+    return bestIdx;
+}
+
+// cross(A, B, p) for the 4 points from `at`
+SOA_AVX2 static inline __m256d crossAt4(const double* x, const double* y, size_t at,
+                                     __m256d vax, __m256d vay, __m256d vdx, __m256d vdy) {
+    __m256d px = _mm256_loadu_pd(x + at), py = _mm256_loadu_pd(y + at);
+    return _mm256_sub_pd(_mm256_mul_pd(vdx, _mm256_sub_pd(py, vay)),
+                         _mm256_mul_pd(vdy, _mm256_sub_pd(px, vax)));
+}
+
+SOA_AVX2 static size_t farthestAVX2(const double* x, const double* y, size_t n,
+                                    const Point& A, const Point& B, double minArea) {
+    const double dx = B.x - A.x, dy = B.y - A.y;
+    double best = minArea;
+    size_t bestIdx = n;
+    size_t i = 0;
+    constexpr size_t W = 4;
+    const __m256d vax = _mm256_set1_pd(A.x), vay = _mm256_set1_pd(A.y);
+    const __m256d vdx = _mm256_set1_pd(dx), vdy = _mm256_set1_pd(dy);
+    const __m256d step = _mm256_set1_pd((double)(2 * W));
+    __m256d vbest0 = _mm256_set1_pd(minArea), vbestIdx0 = _mm256_set1_pd(-1.0);
+    __m256d vbest1 = vbest0, vbestIdx1 = vbestIdx0;
+    __m256d vidx0 = _mm256_set_pd(3, 2, 1, 0);
+    __m256d vidx1 = _mm256_set_pd(7, 6, 5, 4);
+    for (; i + 2 * W <= n; i += 2 * W) {
+        __m256d c0 = crossAt4(x, y, i, vax, vay, vdx, vdy);
+        __m256d c1 = crossAt4(x, y, i + W, vax, vay, vdx, vdy);
+        __m256d gt0 = _mm256_cmp_pd(c0, vbest0, _CMP_GT_OQ);
+        __m256d gt1 = _mm256_cmp_pd(c1, vbest1, _CMP_GT_OQ);
+        vbest0 = _mm256_blendv_pd(vbest0, c0, gt0);
+        vbestIdx0 = _mm256_blendv_pd(vbestIdx0, vidx0, gt0);
+        vbest1 = _mm256_blendv_pd(vbest1, c1, gt1);
+        vbestIdx1 = _mm256_blendv_pd(vbestIdx1, vidx1, gt1);
+        vidx0 = _mm256_add_pd(vidx0, step);
+        vidx1 = _mm256_add_pd(vidx1, step);
+    }
+    if (i + W <= n) {
+        __m256d c0 = crossAt4(x, y, i, vax, vay, vdx, vdy);
+        __m256d gt0 = _mm256_cmp_pd(c0, vbest0, _CMP_GT_OQ);
+        vbest0 = _mm256_blendv_pd(vbest0, c0, gt0);
+        vbestIdx0 = _mm256_blendv_pd(vbestIdx0, vidx0, gt0);
+        i += W;
+    }
+    // lane by lane, the larger area wins, then the smaller index
+    __m256d take1 = _mm256_or_pd(_mm256_cmp_pd(vbest1, vbest0, _CMP_GT_OQ),
+                                 _mm256_and_pd(_mm256_cmp_pd(vbest1, vbest0, _CMP_EQ_OQ),
+                                               _mm256_cmp_pd(vbestIdx1, vbestIdx0, _CMP_LT_OQ)));
+    alignas(32) double laneBest[W], laneIdx[W];
+    _mm256_store_pd(laneBest, _mm256_blendv_pd(vbest0, vbest1, take1));
+    _mm256_store_pd(laneIdx, _mm256_blendv_pd(vbestIdx0, vbestIdx1, take1));
+    mergeBestLanes(W, laneBest, laneIdx, best, bestIdx);
+    farthestTail(x, y, i, n, A, dx, dy, best, bestIdx);
+    return bestIdx;
+}
+#endif
+
+size_t soaFarthestFromEdge(const double* x, const double* y, size_t n,
+                           const Point& A, const Point& B, double minArea) {
+#if defined(SOA_X86)
+    switch (soaKernelIsa()) {
+    case SoaKernelIsa::AVX512: return farthestAVX512(x, y, n, A, B, minArea);
+    case SoaKernelIsa::AVX2: return farthestAVX2(x, y, n, A, B, minArea);
+    case SoaKernelIsa::Scalar: break;
+    }
+#endif
+    double best = minArea;
+    size_t bestIdx = n;
+    farthestTail(x, y, 0, n, A, B.x - A.x, B.y - A.y, best, bestIdx);
+    return bestIdx;
+}
+
+// ===== Side-of-line partition =====
+// Both edges, as the kernels pass them around
+struct SplitEdges {
+    Point A1, A2;
+    double dx1, dy1, min1;
+    double dx2, dy2, min2;
+};
+
+static void splitTail(const double* x, const double* y, size_t i, size_t n, const SplitEdges& e,
+                      double* ox, double* oy, size_t& front, size_t& back) {
+    for (; i < n; i++) {
+        double qx = x[i], qy = y[i];
+        bool in1 = crossAt(e.A1.x, e.A1.y, e.dx1, e.dy1, qx, qy) > e.min1;
+        bool in2 = crossAt(e.A2.x, e.A2.y, e.dx2, e.dy2, qx, qy) > e.min2;
+        // a free slot always remains between front and back, so the unconditional
+        // writes never clobber a kept point
+        ox[front] = qx; oy[front] = qy; front += in1;
+        ox[back - 1] = qx; oy[back - 1] = qy; back -= in2;
+    }
+}
+
+#if defined(SOA_X86)
+SOA_AVX512 static void splitAVX512(const double* x, const double* y, size_t n, const SplitEdges& e,
+                                   double* ox, double* oy, size_t& front, size_t& back) {
+    const Point &A1 = e.A1, &A2 = e.A2;
+    const double dx1 = e.dx1, dy1 = e.dy1, min1 = e.min1, dx2 = e.dx2, dy2 = e.dy2, min2 = e.min2;
+    size_t i = 0;
+    constexpr size_t W = 8;
+    const __m512d ax1 = _mm512_set1_pd(A1.x), ay1 = _mm512_set1_pd(A1.y);
+    const __m512d ax2 = _mm512_set1_pd(A2.x), ay2 = _mm512_set1_pd(A2.y);
+    const __m512d vdx1 = _mm512_set1_pd(dx1), vdy1 = _mm512_set1_pd(dy1);
+    const __m512d vdx2 = _mm512_set1_pd(dx2), vdy2 = _mm512_set1_pd(dy2);
+    const __m512d vmin1 = _mm512_set1_pd(min1), vmin2 = _mm512_set1_pd(min2);
+    // Compress in registers, then full-width stores (compress straight to memory is
+    // microcoded on some cores). The gap between front and back is at least the n - i
+    // points left, so with 2W of them the front store [front, front+W) and the back
+    // store [back-W, back) cannot overlap each other or a kept point
+    for (; i + 2 * W <= n; i += W) {
+        __m512d px = _mm512_loadu_pd(x + i), py = _mm512_loadu_pd(y + i);
+        __m512d c1 = _mm512_sub_pd(_mm512_mul_pd(vdx1, _mm512_sub_pd(py, ay1)),
+                                   _mm512_mul_pd(vdy1, _mm512_sub_pd(px, ax1)));
+        __m512d c2 = _mm512_sub_pd(_mm512_mul_pd(vdx2, _mm512_sub_pd(py, ay2)),
+                                   _mm512_mul_pd(vdy2, _mm512_sub_pd(px, ax2)));
+        __mmask8 m1 = _mm512_cmp_pd_mask(c1, vmin1, _CMP_GT_OQ);
+        __mmask8 m2 = _mm512_cmp_pd_mask(c2, vmin2, _CMP_GT_OQ);
+        _mm512_storeu_pd(ox + front, _mm512_maskz_compress_pd(m1, px));
+        _mm512_storeu_pd(oy + front, _mm512_maskz_compress_pd(m1, py));
+        front += __builtin_popcount(m1);
+        // the back set goes to the high lanes: compress, then shift it up
+        int k2 = __builtin_popcount(m2);
+        __m512i up = _mm512_sub_epi64(_mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi64(W - k2));
+        __mmask8 high = (__mmask8)(0xFF00u >> k2);
+        _mm512_storeu_pd(ox + back - W, _mm512_maskz_permutexvar_pd(high, up, _mm512_maskz_compress_pd(m2, px)));
+        _mm512_storeu_pd(oy + back - W, _mm512_maskz_permutexvar_pd(high, up, _mm512_maskz_compress_pd(m2, py)));
+        back -= k2;
+    }
+    splitTail(x, y, i, n, e, ox, oy, front, back);
+}
+
+// AVX2 has no compress store: a 4-bit lane mask picks a permutation (as 32-bit halves)
+// that moves the selected doubles to the low lanes (front) or, in order, to the high
+// lanes (back)
+struct CompressTable {
+    alignas(32) int32_t front[16][8];
+    alignas(32) int32_t back[16][8];
+};
+
+static CompressTable makeCompressTable() {
+    CompressTable t{};
+    for (int m = 0; m < 16; m++) {
+        int k = 0, first = 4 - __builtin_popcount(m);
+        for (int l = 0; l < 4; l++) {
+            if (!((m >> l) & 1)) continue;
+            t.front[m][2 * k] = 2 * l;
+            t.front[m][2 * k + 1] = 2 * l + 1;
+            t.back[m][2 * (first + k)] = 2 * l;
+            t.back[m][2 * (first + k) + 1] = 2 * l + 1;
+            k++;
+        }
+    }
+    return t;
+}
+
+SOA_AVX2 static inline __m256d compressLanes(__m256d v, __m256i perm) {
+    return _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(v), perm));
+}
+
+SOA_AVX2 static void splitAVX2(const double* x, const double* y, size_t n, const SplitEdges& e,
+                               double* ox, double* oy, size_t& front, size_t& back) {
+    const Point &A1 = e.A1, &A2 = e.A2;
+    const double dx1 = e.dx1, dy1 = e.dy1, min1 = e.min1, dx2 = e.dx2, dy2 = e.dy2, min2 = e.min2;
+    size_t i = 0;
+    constexpr size_t W = 4;
+    const __m256d ax1 = _mm256_set1_pd(A1.x), ay1 = _mm256_set1_pd(A1.y);
+    const __m256d ax2 = _mm256_set1_pd(A2.x), ay2 = _mm256_set1_pd(A2.y);
+    const __m256d vdx1 = _mm256_set1_pd(dx1), vdy1 = _mm256_set1_pd(dy1);
+    const __m256d vdx2 = _mm256_set1_pd(dx2), vdy2 = _mm256_set1_pd(dy2);
+    const __m256d vmin1 = _mm256_set1_pd(min1), vmin2 = _mm256_set1_pd(min2);
+    static const CompressTable table = makeCompressTable();
+    // Full-width stores: the gap between front and back is at least the n - i points
+    // left, so with 2W of them the front store [front, front+W) and the back store
+    // [back-W, back) cannot overlap each other or a kept point
+    for (; i + 2 * W <= n; i += W) {
+        __m256d px = _mm256_loadu_pd(x + i), py = _mm256_loadu_pd(y + i);
+        __m256d c1 = _mm256_sub_pd(_mm256_mul_pd(vdx1, _mm256_sub_pd(py, ay1)),
+                                   _mm256_mul_pd(vdy1, _mm256_sub_pd(px, ax1)));
+        __m256d c2 = _mm256_sub_pd(_mm256_mul_pd(vdx2, _mm256_sub_pd(py, ay2)),
+                                   _mm256_mul_pd(vdy2, _mm256_sub_pd(px, ax2)));
+        int m1 = _mm256_movemask_pd(_mm256_cmp_pd(c1, vmin1, _CMP_GT_OQ));
+        int m2 = _mm256_movemask_pd(_mm256_cmp_pd(c2, vmin2, _CMP_GT_OQ));
+        __m256i p1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(table.front[m1]));
+        __m256i p2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(table.back[m2]));
+        _mm256_storeu_pd(ox + front, compressLanes(px, p1));
+        _mm256_storeu_pd(oy + front, compressLanes(py, p1));
+        _mm256_storeu_pd(ox + back - W, compressLanes(px, p2));
+        _mm256_storeu_pd(oy + back - W, compressLanes(py, p2));
+        front += __builtin_popcount(m1);
+        back -= __builtin_popcount(m2);
+    }
+    splitTail(x, y, i, n, e, ox, oy, front, back);
+}
+#endif
+
+void soaSplitOutside(const double* x, const double* y, size_t n,
+                     const Point& A1, const Point& B1, double min1,
+                     const Point& A2, const Point& B2, double min2,
+                     double* ox, double* oy, size_t& nFront, size_t& nBack) {
+    const SplitEdges e{A1, A2, B1.x - A1.x, B1.y - A1.y, min1, B2.x - A2.x, B2.y - A2.y, min2};
+    size_t front = 0, back = n;
+
+#if defined(SOA_X86)
+    switch (soaKernelIsa()) {
+    case SoaKernelIsa::AVX512: splitAVX512(x, y, n, e, ox, oy, front, back); break;
+    case SoaKernelIsa::AVX2: splitAVX2(x, y, n, e, ox, oy, front, back); break;
+    case SoaKernelIsa::Scalar: splitTail(x, y, 0, n, e, ox, oy, front, back); break;
+    }
+#else
+    splitTail(x, y, 0, n, e, ox, oy, front, back);
+#endif
+
+    nFront = front;
+    nBack = n - back;
+}
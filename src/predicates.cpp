@@ -0,0 +1,115 @@
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "predicates.h"
+
+// ===== Expansion arithmetic =====
+// An expansion is a sum of non-overlapping doubles in increasing magnitude; its sign
+// is the sign of its largest (last) component.
+
+// a + b = x + y exactly
+static inline void twoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+// a * b = x + y exactly
+static inline void twoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+// e += b, keeping e a zero-free expansion (Shewchuk's Grow-Expansion)
+static void growExpansion(std::vector<double>& e, double b) {
+    size_t out = 0;
+    double q = b;
+    for (size_t i = 0; i < e.size(); i++) {
+        double sum, err;
+        twoSum(q, e[i], sum, err);
+        q = sum;
+        if (err != 0) e[out++] = err;
+    }
+    e.resize(out);
+    if (q != 0) e.push_back(q);
+}
+
+// e += a * b * c exactly
+static void addTripleProduct(std::vector<double>& e, double a, double b, double c) {
+    double hi, lo, x, y;
+    twoProduct(a, b, hi, lo);
+    twoProduct(hi, c, x, y);
+    growExpansion(e, y);
+    growExpansion(e, x);
+    twoProduct(lo, c, x, y);
+    growExpansion(e, y);
+    growExpansion(e, x);
+}
+
+static double expansionEstimate(const std::vector<double>& e) {
+    return e.empty() ? 0.0 : e.back();
+}
+
+// Exact sum of products t[i][0] * t[i][1]
+static double sumOfProducts(const double (*terms)[2], size_t count) {
+    std::vector<double> e;
+    e.reserve(2 * count + 4);
+    for (size_t i = 0; i < count; i++) {
+        double x, y;
+        twoProduct(terms[i][0], terms[i][1], x, y);
+        growExpansion(e, y);
+        growExpansion(e, x);
+    }
+    return expansionEstimate(e);
+}
+
+// ===== orient2d =====
+// ax*by - ax*cy - ay*bx + ay*cx + bx*cy - by*cx: no rounded difference is ever formed
+double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy) {
+    const double terms[6][2] = {
+        { ax, by}, {-ax, cy}, {-ay, bx}, { ay, cx}, { bx, cy}, {-by, cx}
+    };
+    return sumOfProducts(terms, 6);
+}
+
+// (bx-ax)(py-qy) - (by-ay)(px-qx), expanded the same way
+double orient2dDeltaExact(double ax, double ay, double bx, double by,
+                          double px, double py, double qx, double qy) {
+    const double terms[8][2] = {
+        { bx, py}, {-bx, qy}, {-ax, py}, { ax, qy},
+        {-by, px}, { by, qx}, { ay, px}, {-ay, qx}
+    };
+    return sumOfProducts(terms, 8);
+}
+
+// ===== orient3d =====
+// e += sign * det3(p, q, r) = sign * p·(q×r), as six exact triple products
+static void addDet3(std::vector<double>& e, double sign, const double* p, const double* q, const double* r) {
+    addTripleProduct(e,  sign * p[0], q[1], r[2]);
+    addTripleProduct(e, -sign * p[0], q[2], r[1]);
+    addTripleProduct(e, -sign * p[1], q[0], r[2]);
+    addTripleProduct(e,  sign * p[1], q[2], r[0]);
+    addTripleProduct(e,  sign * p[2], q[0], r[1]);
+    addTripleProduct(e, -sign * p[2], q[1], r[0]);
+}
+
+static double orient3dExpansion(const double* a, const double* b, const double* c, const double* d) {
+    // det[a-d; b-d; c-d] = det[a 1; b 1; c 1; d 1], expanded along the column of ones
+    // so that no rounded coordinate difference is ever formed
+    std::vector<double> e;
+    e.reserve(64);
+    addDet3(e, -1.0, b, c, d);
+    addDet3(e,  1.0, a, c, d);
+    addDet3(e, -1.0, a, b, d);
+    addDet3(e,  1.0, a, b, c);
+    // Shewchuk's orient3d sign is the opposite of the plane-normal convention used here
+    return -expansionEstimate(e);
+}
+
+double orient3dExact(double ax, double ay, double az, double bx, double by, double bz,
+                     double cx, double cy, double cz, double dx, double dy, double dz) {
+    const double a[3] = {ax, ay, az}, b[3] = {bx, by, bz};
+    const double c[3] = {cx, cy, cz}, d[3] = {dx, dy, dz};
+    return orient3dExpansion(a, b, c, d);
+}
@@ -1,7 +1,17 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <memory>
+#include <stdexcept>
 #include "point.h"
+#include "point_soa.h"
+#include "akl_toussaint.h"
+#include "quick_hull.h"
+#include "predicates.h"
+#include "point_view.h"
+#include "fork_join_pool.h"
 
 // Deduplicate hull points
 void deduplicateHull(std::vector<Point>& hull) {
@@ -58,25 +68,433 @@ void quickHullRec(const std::vector<Point>& pts, const Point& A, const Point& B,
     quickHullRec(pts, pts[idx], B, hull);
 }
 
+// The CCW recursion ends with A again (and with A twice when A and B coincide);
+// drop those so every vertex appears once.
+template <typename T>
+static void closeCounterClockwise(std::vector<BasicPoint<T>>& hull) {
+    hull.pop_back();
+    if (hull.size() == 2 && hull[0] == hull[1]) hull.pop_back();
+}
+
+// Partition-based recursive helper: [first, last) holds only the points strictly
+// outside edge A->B. The farthest point P splits the range in place into the points
+// outside (A,P) and the points outside (P,B); everything else lies inside triangle
+// ABP and is dropped, so each call only touches the candidates that are still alive.
+// Hull vertices are emitted walking from B back to A (B excluded, A included), which
+// is counter-clockwise order: the output needs no sorting or deduplication.
+// Works on any random-access range of points (vector iterators, raw buffers).
+template <typename T, class It>
+static void partitionRec(It first, It last, const BasicPoint<T>& A, const BasicPoint<T>& B,
+                         std::vector<BasicPoint<T>>& hull) {
+    if (first == last) {
+        // No point is left → A and B form part of hull
+        hull.push_back(A);
+        return;
+    }
+
+    // Every point in range is already known to be outside, so only the distances are
+    // compared, exactly: a rounded maximum could pick a point that is not a hull vertex
+    auto far = first;
+    FarthestFromEdgeScan<T> scan(A, B);
+    for (auto it = first; it != last; ++it) {
+        if (scan.offer(*it)) far = it;
+    }
+
+    // Side tests go through the exact orientation predicate
+    const BasicPoint<T> P = *far;
+    auto midA = std::partition(first, last,
+        [&](const BasicPoint<T>& p) { return orientation(A, P, p) > 0; });
+    auto midB = std::partition(midA, last,
+        [&](const BasicPoint<T>& p) { return orientation(P, B, p) > 0; });
+
+    partitionRec<T>(midA, midB, P, B, hull);
+    partitionRec<T>(first, midA, A, P, hull);
+}
+
+template <typename T>
+void quickHullPartitionRec(typename std::vector<BasicPoint<T>>::iterator first,
+                           typename std::vector<BasicPoint<T>>::iterator last,
+                           const BasicPoint<T>& A, const BasicPoint<T>& B,
+                           std::vector<BasicPoint<T>>& hull) {
+    partitionRec<T>(first, last, A, B, hull);
+}
+
+// QuickHull on at least 3 points: reorders pts and appends the hull to `hull`
+template <typename T>
+static void quickHullInPlace(std::vector<BasicPoint<T>>& pts, std::vector<BasicPoint<T>>& hull) {
+    // Find leftmost and rightmost points
+    auto [minIt, maxIt] = std::minmax_element(pts.begin(), pts.end(),
+        [](const BasicPoint<T>& a, const BasicPoint<T>& b) { return a.x < b.x; });
+    BasicPoint<T> A = *minIt, B = *maxIt;
+
+    // Split once into the points above A->B and the points above B->A;
+    // the recursion never looks at the rest again.
+    auto upperEnd = std::partition(pts.begin(), pts.end(),
+        [&](const BasicPoint<T>& p) { return orientation(A, B, p) > 0; });
+    auto lowerEnd = std::partition(upperEnd, pts.end(),
+        [&](const BasicPoint<T>& p) { return orientation(B, A, p) > 0; });
+
+    hull.push_back(A);
+
+    quickHullPartitionRec<T>(upperEnd, lowerEnd, B, A, hull);    // Lower side: A → B
+    quickHullPartitionRec<T>(pts.begin(), upperEnd, A, B, hull); // Upper side: B → A
+
+    closeCounterClockwise(hull);
+}
+
 // QuickHull main: define the closest point A and the furthest point B based on X asis.
 // run recursively at 2 parts: lower (A->B) and upper (B->A)
-std::vector<Point> quickHull(std::vector<Point> pts) {
+template <typename T>
+std::vector<BasicPoint<T>> quickHull(std::vector<BasicPoint<T>> pts) {
     if (pts.size() < 3) return pts;
+    std::vector<BasicPoint<T>> hull;
+    quickHullInPlace(pts, hull);
+    return hull;
+}
 
-    // Find leftmost and rightmost points
-    auto [minIt, maxIt] = std::minmax_element(pts.begin(), pts.end(),
-        [](const Point& a, const Point& b) { return a.x < b.x; });
-    Point A = *minIt, B = *maxIt;
+// Compile-time dispatch: one instantiation per coordinate kernel
+template void quickHullPartitionRec<float>(std::vector<PointF>::iterator, std::vector<PointF>::iterator,
+                                           const PointF&, const PointF&, std::vector<PointF>&);
+template void quickHullPartitionRec<double>(std::vector<Point>::iterator, std::vector<Point>::iterator,
+                                            const Point&, const Point&, std::vector<Point>&);
+template void quickHullPartitionRec<int64_t>(std::vector<PointI>::iterator, std::vector<PointI>::iterator,
+                                             const PointI&, const PointI&, std::vector<PointI>&);
+template std::vector<PointF> quickHull<float>(std::vector<PointF>);
+template std::vector<Point> quickHull<double>(std::vector<Point>);
+template std::vector<PointI> quickHull<int64_t>(std::vector<PointI>);
+
+// QuickHull with optional Akl–Toussaint prefilter
+std::vector<Point> quickHull(std::vector<Point> pts, bool prefilter, size_t* removed) {
+    size_t dropped = prefilter ? aklToussaintFilter(pts) : 0;
+    if (removed) *removed = dropped;
+    return quickHull(std::move(pts));
+}
+
+// QuickHull over a point view: only the points outside the Akl–Toussaint polygon are
+// copied. Points strictly inside it are never a pivot nor a vertex, so quickHull on the
+// survivors makes exactly the same choices as on the whole input.
+size_t quickHull(const PointView& in, Point* out, size_t capacity, std::vector<Point>& scratch) {
+    Point poly[8];
+    size_t m = aklToussaintPolygon(in, poly);
+    scratch.clear();
+    for (size_t i = 0; i < in.size(); i++) {
+        Point p = in[i];
+        if (m == 0 || !aklToussaintInside(poly, m, p)) scratch.push_back(p);
+    }
 
     std::vector<Point> hull;
+    if (scratch.size() < 3) hull = scratch;
+    else quickHullInPlace(scratch, hull);
+
+    std::copy_n(hull.begin(), std::min(hull.size(), capacity), out);
+    return hull.size();
+}
+
+// quickHullPartitionRec on indices into a view: same pivots, same emission order
+static void quickHullIndexRec(std::vector<uint32_t>::iterator first, std::vector<uint32_t>::iterator last,
+                              uint32_t a, uint32_t b, const PointView& in, std::vector<uint32_t>& hull) {
+    if (first == last) {
+        hull.push_back(a);
+        return;
+    }
+
+    const Point A = in[a], B = in[b];
+    auto far = first;
+    FarthestFromEdgeScan<double> scan(A, B);
+    for (auto it = first; it != last; ++it) {
+        if (scan.offer(in[*it])) far = it;
+    }
+
+    const uint32_t p = *far;
+    const Point P = in[p];
+    auto midA = std::partition(first, last,
+        [&](uint32_t i) { return orientation(A, P, in[i]) > 0; });
+    auto midB = std::partition(midA, last,
+        [&](uint32_t i) { return orientation(P, B, in[i]) > 0; });
+
+    quickHullIndexRec(midA, midB, p, b, in, hull);
+    quickHullIndexRec(first, midA, a, p, in, hull);
+}
+
+// QuickHull returning indices, over the points outside the Akl–Toussaint polygon
+std::vector<uint32_t> quickHullIndices(const PointView& in) {
+    if (in.size() > UINT32_MAX) throw std::length_error("quickHullIndices: more than 2^32 - 1 points");
+    Point poly[8];
+    size_t m = aklToussaintPolygon(in, poly);
+    std::vector<uint32_t> idx;
+    for (size_t i = 0; i < in.size(); i++) {
+        if (m == 0 || !aklToussaintInside(poly, m, in[i])) idx.push_back((uint32_t)i);
+    }
+    if (idx.size() < 3) return idx;
+
+    // Leftmost (first) and rightmost (last) points, as std::minmax_element picks them
+    uint32_t a = idx[0], b = idx[0];
+    for (uint32_t i : idx) {
+        if (in[i].x < in[a].x) a = i;
+        if (in[i].x >= in[b].x) b = i;
+    }
+    const Point A = in[a], B = in[b];
+
+    auto upperEnd = std::partition(idx.begin(), idx.end(),
+        [&](uint32_t i) { return orientation(A, B, in[i]) > 0; });
+    auto lowerEnd = std::partition(upperEnd, idx.end(),
+        [&](uint32_t i) { return orientation(B, A, in[i]) > 0; });
+
+    std::vector<uint32_t> hull;
+    hull.push_back(a);
+    quickHullIndexRec(upperEnd, lowerEnd, b, a, in, hull);      // Lower side: A → B
+    quickHullIndexRec(idx.begin(), upperEnd, a, b, in, hull);   // Upper side: B → A
+
+    // as closeCounterClockwise: drop the trailing A, and the second copy of a single point
+    hull.pop_back();
+    if (hull.size() == 2 && in[hull[0]] == in[hull[1]]) hull.pop_back();
+    return hull;
+}
+
+// Number of blocks a parallel pass over n points is cut into: one per pool thread, as
+// long as each gets at least `cutoff` points
+static size_t blockCount(const ForkJoinPool& pool, size_t n, size_t cutoff) {
+    return std::max<size_t>(1, std::min<size_t>(pool.size(), n / std::max<size_t>(cutoff, 1)));
+}
+
+// The two outside sets a split produces, and the farthest point of each from its edge
+// (meaningful only when the set is not empty)
+struct OutsideSplit {
+    size_t nA = 0, nB = 0;
+    Point farA{}, farB{};
+};
+
+// Writes the points of src[0, n) strictly outside edge A1->B1 to dst[0, nA) and the
+// remaining ones strictly outside A2->B2 to dst[n - nB, n); the rest is dropped. This
+// is quickHull's pair of std::partition calls, out of place, fused with the farthest-
+// point scans the next level would otherwise make over both sets. Above `cutoff`
+// points per block, each block tags its points with their side, counts them and keeps
+// its own farthest points; a prefix sum over the blocks gives each block its output
+// ranges, and every block scatters its points there concurrently. The farthest-point
+// order is total (fartherFromEdge), so block winners combine to the serial scan's
+// choice. `tags` is scratch for n sides.
+static OutsideSplit splitOutside(ForkJoinPool& pool, const Point* src, Point* dst, uint8_t* tags, size_t n,
+                                 const Point& A1, const Point& B1, const Point& A2, const Point& B2,
+                                 size_t cutoff) {
+    struct Block {
+        size_t nA = 0, nB = 0;
+        const Point* farA = nullptr;
+        const Point* farB = nullptr;
+    };
+    // tags each point of [lo, hi): 1 outside the first edge, 2 outside the second, 0 neither
+    auto classify = [&](size_t lo, size_t hi, uint8_t* tag, Block& block) {
+        FarthestFromEdgeScan<double> scanA(A1, B1), scanB(A2, B2);
+        for (size_t i = lo; i < hi; i++) {
+            const Point& p = src[i];
+            uint8_t s = orientation(A1, B1, p) > 0 ? 1 : orientation(A2, B2, p) > 0 ? 2 : 0;
+            if (s == 1) {
+                block.nA++;
+                if (scanA.offer(p)) block.farA = &p;
+            } else if (s == 2) {
+                block.nB++;
+                if (scanB.offer(p)) block.farB = &p;
+            }
+            tag[i] = s;
+        }
+    };
+
+    OutsideSplit out;
+    size_t blocks = blockCount(pool, n, cutoff);
+    if (blocks == 1) {
+        // one pass: the first set grows from the front, the second from the back
+        Block block;
+        classify(0, n, tags, block);
+        for (size_t i = 0; i < n; i++) {
+            if (tags[i] == 1) dst[out.nA++] = src[i];
+            else if (tags[i] == 2) dst[n - ++out.nB] = src[i];
+        }
+        if (block.farA) out.farA = *block.farA;
+        if (block.farB) out.farB = *block.farB;
+        return out;
+    }
+
+    std::vector<Block> block(blocks);
+    auto bound = [&](size_t c) { return n * c / blocks; };
+    pool.parallelFor(blocks, [&](size_t c) { classify(bound(c), bound(c + 1), tags, block[c]); });
+
+    // prefix sums: block c writes its sets from offsetA[c] and offsetB[c] on
+    std::vector<size_t> offsetA(blocks), offsetB(blocks);
+    const Point* farA = nullptr;
+    const Point* farB = nullptr;
+    for (size_t c = 0; c < blocks; c++) {
+        offsetA[c] = out.nA;
+        offsetB[c] = out.nB;
+        out.nA += block[c].nA;
+        out.nB += block[c].nB;
+        if (block[c].farA && (!farA || fartherFromEdge(A1, B1, *block[c].farA, *farA))) farA = block[c].farA;
+        if (block[c].farB && (!farB || fartherFromEdge(A2, B2, *block[c].farB, *farB))) farB = block[c].farB;
+    }
+    if (farA) out.farA = *farA;
+    if (farB) out.farB = *farB;
+
+    pool.parallelFor(blocks, [&](size_t c) {
+        Point* outA = dst + offsetA[c];
+        Point* outB = dst + (n - out.nB) + offsetB[c];
+        for (size_t i = bound(c); i < bound(c + 1); i++) {
+            if (tags[i] == 1) *outA++ = src[i];
+            else if (tags[i] == 2) *outB++ = src[i];
+        }
+    });
+    return out;
+}
+
+// Fork-join version of quickHullPartitionRec over two buffers, as quickHullSoARec:
+// src[lo, lo+n) holds the points outside edge A->B, P the farthest of them (found by
+// the split that produced them). The split writes both outside sets into dst over the
+// same range, and the children swap the roles of src and dst. The (A,P) side is forked
+// into the pool while the (P,B) side continues on this thread. Below `cutoff` points
+// it falls back to the serial in-place recursion.
+static void quickHullParallelRec(ForkJoinPool& pool, Point* src, Point* dst, uint8_t* tags,
+                                 size_t lo, size_t n, const Point& A, const Point& B, const Point& P,
+                                 std::vector<Point>& hull, size_t cutoff) {
+    if (n == 0 || n < cutoff) {
+        partitionRec<double>(src + lo, src + lo + n, A, B, hull);
+        return;
+    }
+
+    OutsideSplit split = splitOutside(pool, src + lo, dst + lo, tags + lo, n, A, P, P, B, cutoff);
+
+    // (P,B) comes first in counter-clockwise order
+    std::vector<Point> fromB, toA;
+    ForkJoinPool::Group group;
+    pool.fork(group, [&] {
+        quickHullParallelRec(pool, dst, src, tags, lo, split.nA, A, P, split.farA, toA, cutoff);
+    });
+    quickHullParallelRec(pool, dst, src, tags, lo + n - split.nB, split.nB, P, B, split.farB, fromB, cutoff);
+    pool.join(group);
+
+    hull.insert(hull.end(), fromB.begin(), fromB.end());
+    hull.insert(hull.end(), toA.begin(), toA.end());
+}
+
+// Parallel QuickHull: same splitting as quickHull. Every pass over a range above
+// `cutoff` points (extremes, farthest point, split) is cut into blocks across one
+// bounded pool, and both sides of every such split run as pool tasks.
+std::vector<Point> quickHullParallel(std::vector<Point> pts, size_t cutoff, unsigned threads) {
+    const size_t n = pts.size();
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (n < 3 || threads == 1 || n < cutoff) return quickHull(std::move(pts));
+    ForkJoinPool pool(threads);
+
+    // Leftmost (first) and rightmost (last) points, as std::minmax_element picks them:
+    // block winners are combined in block order with the same tie rules
+    size_t blocks = blockCount(pool, n, cutoff);
+    std::vector<size_t> iMin(blocks), iMax(blocks);
+    pool.parallelFor(blocks, [&](size_t c) {
+        size_t lo = n * c / blocks, hi = n * (c + 1) / blocks;
+        size_t a = lo, b = lo;
+        for (size_t i = lo + 1; i < hi; i++) {
+            if (pts[i].x < pts[a].x) a = i;
+            if (pts[i].x >= pts[b].x) b = i;
+        }
+        iMin[c] = a;
+        iMax[c] = b;
+    });
+    size_t a = iMin[0], b = iMax[0];
+    for (size_t c = 1; c < blocks; c++) {
+        if (pts[iMin[c]].x < pts[a].x) a = iMin[c];
+        if (pts[iMax[c]].x >= pts[b].x) b = iMax[c];
+    }
+    const Point A = pts[a], B = pts[b];
+
+    // left uninitialised: the splits write every slot before it is read, in parallel
+    std::unique_ptr<Point[]> work(new Point[n]);
+    std::unique_ptr<uint8_t[]> tags(new uint8_t[n]);
+    OutsideSplit split = splitOutside(pool, pts.data(), work.get(), tags.get(), n, A, B, B, A, cutoff);
+
+    std::vector<Point> upper, lower;
+    ForkJoinPool::Group group;
+    pool.fork(group, [&] {
+        quickHullParallelRec(pool, work.get(), pts.data(), tags.get(), 0, split.nA, A, B, split.farA,
+                             upper, cutoff);
+    });
+    quickHullParallelRec(pool, work.get(), pts.data(), tags.get(), n - split.nB, split.nB, B, A, split.farB,
+                         lower, cutoff);
+    pool.join(group);
+
+    std::vector<Point> hull;
+    hull.reserve(1 + upper.size() + lower.size());
     hull.push_back(A);
+    hull.insert(hull.end(), lower.begin(), lower.end());
+    hull.insert(hull.end(), upper.begin(), upper.end());
+
+    closeCounterClockwise(hull);
+    return hull;
+}
+
+// One ping-pong buffer of the SoA recursion
+struct SoABuffer {
+    double* x;
+    double* y;
+};
+
+// SoA recursion: src holds the points outside edge A->B in [lo, lo+n). The split writes
+// the two outside sets into dst over the same range, and the children swap the roles
+// of src and dst, so no allocation happens below the top level.
+static void quickHullSoARec(SoABuffer src, SoABuffer dst, size_t lo, size_t n,
+                            const Point& A, const Point& B, std::vector<Point>& hull) {
+    size_t far = soaFarthestFromEdge(src.x + lo, src.y + lo, n, A, B, minCrossForEdge(A, B));
+    if (far == n) {
+        hull.push_back(A);
+        return;
+    }
+
+    const Point P = {src.x[lo + far], src.y[lo + far]};
+    size_t nA = 0, nB = 0;
+    soaSplitOutside(src.x + lo, src.y + lo, n,
+                    A, P, minCrossForEdge(A, P), P, B, minCrossForEdge(P, B),
+                    dst.x + lo, dst.y + lo, nA, nB);
+
+    quickHullSoARec(dst, src, lo + n - nB, nB, P, B, hull);
+    quickHullSoARec(dst, src, lo, nA, A, P, hull);
+}
+
+// QuickHull over structure-of-arrays input, using the vectorized scan kernels; work and
+// scratch hold n points each
+static std::vector<Point> soaHull(const PointsSoA& pts, SoABuffer work, SoABuffer scratch) {
+    const size_t n = pts.size();
+    if (n < 3) {
+        std::vector<Point> out;
+        for (size_t i = 0; i < n; i++) out.push_back(pts[i]);
+        return out;
+    }
 
-    quickHullRec(pts, A, B, hull); // Upper side
-    quickHullRec(pts, B, A, hull); // Lower side
+    size_t iMin = 0, iMax = 0;
+    soaExtremesX(pts.x.data(), n, iMin, iMax);
+    Point A = pts[iMin], B = pts[iMax];
+
+    size_t nUpper = 0, nLower = 0;
+    double minAB = minCrossForEdge(A, B);
+    soaSplitOutside(pts.x.data(), pts.y.data(), n, A, B, minAB, B, A, minAB,
+                    work.x, work.y, nUpper, nLower);
+
+    std::vector<Point> hull;
+    hull.push_back(A);
 
-    //remove the duplicates of last item A because both Upper & Lower sides have it.
-    deduplicateHull(hull);
-    sortCounterClockwise(hull);
+    quickHullSoARec(work, scratch, n - nLower, nLower, B, A, hull); // Lower side: A → B
+    quickHullSoARec(work, scratch, 0, nUpper, A, B, hull);          // Upper side: B → A
 
+    closeCounterClockwise(hull);
     return hull;
-}
\ No newline at end of file
+}
+
+std::vector<Point> quickHullSoA(const PointsSoA& pts) {
+    const size_t n = pts.size();
+    // left uninitialised: zeroing 4n doubles costs more than the whole recursion, and
+    // the splits write every slot before it is read
+    std::unique_ptr<double[]> buffers(new double[4 * n]);
+    return soaHull(pts, {buffers.get(), buffers.get() + n},
+                   {buffers.get() + 2 * n, buffers.get() + 3 * n});
+}
+
+std::vector<Point> quickHullSoA(const PointsSoA& pts, PointsSoA& scratch) {
+    const size_t n = pts.size();
+    if (scratch.size() < 2 * n) scratch.resize(2 * n);
+    return soaHull(pts, {scratch.x.data(), scratch.y.data()},
+                   {scratch.x.data() + n, scratch.y.data() + n});
+}
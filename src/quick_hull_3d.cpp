@@ -3,21 +3,25 @@
 #include <limits>
 #include <cmath>
 #include <cstddef>
-#include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
 #include <queue>
 #include <stdexcept>
+#include <climits>
 #include "quick_hull_3d.h"
+#include "predicates.h"
 
 namespace qh3d {
 // -------------------- QuickHull 3D --------------------
-    QuickHull3D::QuickHull3D(const std::vector<Vec3>& points, double epsilon)
-        : pts(points), eps(epsilon) {}
+    QuickHull3D::QuickHull3D(const PointView3D& points, double epsilon, size_t compactMin)
+        : pts(points), eps(epsilon), compactMinFree(compactMin) {
+        // faces and outside sets hold int indices
+        if (pts.size() > (size_t)INT_MAX) throw std::length_error("QuickHull3D: more than 2^31 - 1 points");
+    }
 
-    // public API: compute convex hull faces (as triplets of indices)
-    std::vector<std::array<int,3>> QuickHull3D::compute() {
-        if (pts.size() < 4) return {}; // degenerate
+    // run the whole algorithm; false when there are too few points for a hull
+    bool QuickHull3D::build() {
+        if (pts.size() < 4) return false; // degenerate
 
         // 1) Build initial tetrahedron
         std::array<int,4> base = initialTetrahedron();
@@ -28,6 +32,12 @@ namespace qh3d {
 
         // 3) Expand hull
         expand();
+        return true;
+    }
+
+    // public API: compute convex hull faces (as triplets of indices)
+    std::vector<std::array<int,3>> QuickHull3D::compute() {
+        if (!build()) return {};
 
         // 4) Collect final faces
         std::vector<std::array<int,3>> out;
@@ -36,6 +46,18 @@ namespace qh3d {
         return out;
     }
 
+    // same, into a caller-provided buffer
+    size_t QuickHull3D::compute(std::array<int,3>* out, size_t capacity) {
+        if (!build()) return 0;
+
+        size_t count = 0;
+        for (auto& f : faces) if (f.alive) {
+            if (count < capacity) out[count] = f.v;
+            count++;
+        }
+        return count;
+    }
+
     // choose initial tetrahedron: four non-coplanar extreme points
     std::array<int,4> QuickHull3D::initialTetrahedron() {
         const int n = (int)pts.size();
@@ -62,7 +84,7 @@ namespace qh3d {
             double d = norm(crossp) / std::sqrt(ab2);
             if (d > max_dist) { max_dist = d; i_far_line = i; }
         }
-        if (i_far_line<0 || max_dist < eps) throw std::runtime_error("Points are collinear.");
+        if (i_far_line<0 || max_dist <= eps) throw std::runtime_error("Points are collinear.");
 
         // find a point that makes a non-degenerate tetrahedron
         int i_far_plane=-1;
@@ -73,7 +95,7 @@ namespace qh3d {
             double h = std::abs(pl.signedDistance(pts[i]));
             if (h > max_abs_height) { max_abs_height = h; i_far_plane = i; }
         }
-        if (i_far_plane<0 || max_abs_height < eps) throw std::runtime_error("Points are coplanar.");
+        if (i_far_plane<0 || max_abs_height <= eps) throw std::runtime_error("Points are coplanar.");
 
         return {i_min_x, i_max_x, i_far_line, i_far_plane};
     }
@@ -100,6 +122,7 @@ namespace qh3d {
     void QuickHull3D::initTetraFaces(const std::array<int,4>& T) {
         faces.clear();
         faces.reserve(64);
+        freeFaces.clear();
         Vec3 centroid = (pts[T[0]] + pts[T[1]] + pts[T[2]] + pts[T[3]]) * 0.25;
 
         auto make = [&](int a,int b,int c){
@@ -115,6 +138,31 @@ namespace qh3d {
         faces.push_back(make(T[0], T[3], T[1]));
         faces.push_back(make(T[1], T[3], T[2]));
         faces.push_back(make(T[2], T[3], T[0]));
+
+        // every edge a -> b of one face runs b -> a in exactly one other
+        for (int f = 0; f < 4; ++f)
+            for (int i = 0; i < 3; ++i)
+                for (int g = 0; g < 4; ++g) {
+                    int t = g == f ? -1 : edgeStartingAt(g, faces[f].v[(i+1)%3]);
+                    if (t >= 0 && faces[g].v[(t+1)%3] == faces[f].v[i]) faces[f].nb[i] = g;
+                }
+    }
+
+    int QuickHull3D::edgeStartingAt(int f, int a) const {
+        const auto& v = faces[f].v;
+        return v[0] == a ? 0 : v[1] == a ? 1 : v[2] == a ? 2 : -1;
+    }
+
+    // signed distance of point p above face f. In exact mode (eps == 0) the filtered
+    // orient3d predicate decides the sign and the plane only supplies the magnitude.
+    double QuickHull3D::distanceAbove(const Face& f, int p) const {
+        double d = f.plane.signedDistance(pts[p]);
+        if (eps > 0) return d;
+
+        const Vec3 &a = pts[f.v[0]], &b = pts[f.v[1]], &c = pts[f.v[2]], &q = pts[p];
+        double o = orient3d(a.x, a.y, a.z, b.x, b.y, b.z, c.x, c.y, c.z, q.x, q.y, q.z);
+        if (o > 0) return std::max(d, std::numeric_limits<double>::denorm_min());
+        return std::min(d, 0.0);
     }
 
     void QuickHull3D::assignOutsidePoints() {
@@ -131,139 +179,129 @@ namespace qh3d {
             for (int fi=0; fi<(int)faces.size(); ++fi) {
                 Face& f = faces[fi];
                 if (!f.alive) continue;
-                double d = f.plane.signedDistance(pts[i]);
+                double d = distanceAbove(f, i);
                 if (d > best_d) { best_d = d; best = fi; }
             }
-            if (best >= 0) faces[best].outside.push_back(i);
+            if (best >= 0) addOutside(best, i, best_d);
         }
+        for (int fi=0; fi<(int)faces.size(); ++fi) queueFace(fi);
     }
 
-    // pick a face that currently has outside points
-    int QuickHull3D::pickFaceWithOutside() const {
-        int best = -1;
-        double best_far = -1.0;
-        for (int i=0;i<(int)faces.size();++i) {
-            const Face& f = faces[i];
-            if (!f.alive || f.outside.empty()) continue;
-            // heuristic: use farthest point distance to prioritize
-            double maxd = 0;
-            for (int pi : f.outside) {
-                maxd = std::max(maxd, f.plane.signedDistance(pts[pi]));
-            }
-            if (maxd > best_far) { best_far = maxd; best = i; }
+    void QuickHull3D::addOutside(int f, int p, double d) {
+        Face& face = faces[f];
+        face.outside.push_back(p);
+        if (d > face.farthestDist) { face.farthestDist = d; face.farthest = p; }
+    }
+
+    void QuickHull3D::queueFace(int f) {
+        if (!faces[f].outside.empty()) faceQueue.push({faces[f].farthestDist, f, faces[f].gen});
+    }
+
+    // pop the live face whose farthest point is farthest away; entries of faces that
+    // died since they were queued, or whose slot has been reused, are dropped on the way
+    int QuickHull3D::pickFaceWithOutside() {
+        while (!faceQueue.empty()) {
+            QueuedFace top = faceQueue.top();
+            faceQueue.pop();
+            const Face& f = faces[top.face];
+            if (f.gen == top.gen && f.alive && !f.outside.empty()) return top.face;
         }
-        return best;
+        return -1;
     }
 
-    // find farthest point from a face among its outside set
+    // cached when the outside set was filled
     int QuickHull3D::farthestPointFromFace(const Face& f) const {
-        int far = -1;
-        double best = -1.0;
-        for (int pi : f.outside) {
-            double d = f.plane.signedDistance(pts[pi]);
-            if (d > best) { best = d; far = pi; }
-        }
-        return far;
+        return f.farthest;
     }
 
-    // mark all faces visible from point p
-    void QuickHull3D::collectVisibleFaces(int p, std::vector<int>& visible) const {
+    // flood fill from a face p is above, across neighbours p is also above
+    void QuickHull3D::collectVisibleFaces(int start, int p, std::vector<int>& visible) {
         visible.clear();
-        for (int i=0;i<(int)faces.size(); ++i) {
-            const Face& f = faces[i];
-            if (!f.alive) continue;
-            if (f.plane.signedDistance(pts[p]) > eps) visible.push_back(i);
+        faces[start].mark = 0;
+        visible.push_back(start);
+        // `visible` doubles as the BFS queue; mark >= 0 flags faces already in it
+        for (size_t head = 0; head < visible.size(); ++head) {
+            for (int g : faces[visible[head]].nb) {
+                if (faces[g].mark >= 0) continue;
+                if (distanceAbove(faces[g], p) > eps) {
+                    faces[g].mark = (int)visible.size();
+                    visible.push_back(g);
+                }
+            }
         }
     }
 
-    // Find horizon as list of directed edges (u->v) bordering a visible and a non-visible face
-    // We collect undirected edge counts among visible faces; edges with count==1 lie on boundary.
-    // Then we orient each boundary edge so that the winding with the new apex will be CCW outward.
-    std::vector<std::pair<int,int>>
+    // Horizon as an ordered loop of directed edges bordering the (dead) visible faces
+    std::vector<HorizonEdge>
     QuickHull3D::computeHorizon(const std::vector<int>& visible) {
-        // mark visible set
-        std::unordered_set<int> vis(visible.begin(), visible.end());
-
-        // count undirected edges inside visible faces
-        std::unordered_map<UEdge,int,UEdgeHash> cnt;
-        auto add_edge = [&](int a,int b){
-            cnt[UEdge(a,b)]++;
-        };
-
+        // any edge of a visible face with a live face behind it starts the loop
+        int f0 = -1, e0 = -1;
         for (int fi : visible) {
-            const auto& f = faces[fi];
-            add_edge(f.v[0], f.v[1]);
-            add_edge(f.v[1], f.v[2]);
-            add_edge(f.v[2], f.v[0]);
+            for (int i = 0; i < 3 && f0 < 0; ++i)
+                if (faces[faces[fi].nb[i]].alive) { f0 = fi; e0 = i; }
+            if (f0 >= 0) break;
         }
 
-        // Any undirected edge appearing exactly once is part of the horizon.
-        // We need to retrieve it as a directed cycle. Build adjacency to order them.
-        std::unordered_map<int, std::vector<int>> adj;
-        for (auto& kv : cnt) {
-            if (kv.second == 1) {
-                int a = kv.first.a, b = kv.first.b;
-                adj[a].push_back(b);
-                adj[b].push_back(a);
+        if (f0 < 0) throw std::runtime_error("QuickHull3D: every face is visible from the apex");
+
+        // a closed loop crosses each edge of a visible face at most once, and turns
+        // through at most all of them around one vertex; more means the mesh is broken
+        const size_t limit = 3 * visible.size();
+        std::vector<HorizonEdge> horizon;
+        int f = f0, e = e0;
+        do {
+            if (horizon.size() == limit) throw std::runtime_error("QuickHull3D: horizon walk did not close");
+            const Face& F = faces[f];
+            horizon.push_back({F.v[e], F.v[(e+1)%3], F.mark, F.nb[e]});
+
+            // turn around the end vertex w through visible faces: the next edge of f
+            // starts at w; while a visible face lies behind it, cross into that face and
+            // take its edge starting at w, the one after the twin
+            const int w = F.v[(e+1)%3];
+            int g = f, j = (e+1)%3;
+            for (size_t turns = 0; !faces[faces[g].nb[j]].alive; ++turns) {
+                g = faces[g].nb[j];
+                j = edgeStartingAt(g, w);
+                if (j < 0 || turns == visible.size())
+                    throw std::runtime_error("QuickHull3D: horizon walk did not close");
             }
-        }
-
-        // Start from a vertex with degree 1 (open chain) or any (cycle)
-        int start = -1;
-        for (auto& kv : adj) { if (kv.second.size() == 1) { start = kv.first; break; } }
-        if (start == -1 && !adj.empty()) start = adj.begin()->first;
-
-        // Build an ordered edge loop/path
-        std::vector<int> ordered;
-        if (start != -1) {
-            int prev = -1, cur = start;
-            while (true) {
-                ordered.push_back(cur);
-                auto& nbrs = adj[cur];
-                int next = -1;
-                for (int nb : nbrs) if (nb != prev) { next = nb; break; }
-                if (next == -1) break;
-                prev = cur; cur = next;
-                if (cur == start) { ordered.push_back(cur); break; } // closed loop
-            }
-        }
-
-        // Convert to directed edges along the path (or loop)
-        std::vector<std::pair<int,int>> horizon;
-        for (size_t i=1;i<ordered.size();++i)
-            horizon.emplace_back(ordered[i-1], ordered[i]);
+            f = g; e = j;
+        } while (f != f0 || e != e0);
 
         return horizon;
     }
 
-    // Reassign points from a set of removed faces to the new faces' outside sets
+    // Reassign points from a set of removed faces to the new faces' outside sets.
+    // Every point sits in exactly one outside set, so no deduplication is needed.
     void QuickHull3D::reassignOutsidePoints(
+        int apex,
         const std::vector<int>& removedFaces,
-        const std::vector<int>& newFaceIdx)
+        const std::vector<int>& newFaceIdx,
+        const std::vector<int>& ringStart)
     {
-        // gather all candidate points
-        std::vector<int> candidates;
-        {
-            std::unordered_set<int> seen;
-            for (int fi : removedFaces) {
-                for (int p : faces[fi].outside) if (!seen.count(p)) {
-                    seen.insert(p); candidates.push_back(p);
+        const int k = (int)newFaceIdx.size();
+        for (size_t i = 0; i < removedFaces.size(); ++i) {
+            const int fi = removedFaces[i];
+            std::vector<int> orphans = std::move(faces[fi].outside);
+            faces[fi].outside.clear();
+            const int start = std::max(ringStart[i], 0);
+
+            for (int p : orphans) {
+                if (p == apex) continue;   // now a hull vertex
+
+                // start, start+1, start-1, start+2, ... around the ring
+                for (int step = 0; step < k; ++step) {
+                    int off = (step & 1) ? (step + 1) / 2 : -(step / 2);
+                    int nf = newFaceIdx[((start + off) % k + k) % k];
+                    double d = distanceAbove(faces[nf], p);
+                    if (d > eps) {
+                        addOutside(nf, p, d);
+                        break;
+                    }
                 }
-                faces[fi].outside.clear();
+                // above no new face: inside the new hull, dropped for good
             }
         }
-        if (candidates.empty() || newFaceIdx.empty()) return;
-
-        for (int p : candidates) {
-            int best = -1;
-            double bestd = eps;
-            for (int fi : newFaceIdx) {
-                Face& f = faces[fi];
-                double d = f.plane.signedDistance(pts[p]);
-                if (d > bestd) { bestd = d; best = fi; }
-            }
-            if (best >= 0) faces[best].outside.push_back(p);
-        }
     }
 
     void QuickHull3D::expand() {
@@ -275,51 +313,80 @@ namespace qh3d {
             int apex = farthestPointFromFace(base);
             if (apex < 0) { base.outside.clear(); continue; }
 
-            // 1) collect all faces visible from apex
+            // 1) collect the faces visible from apex, starting from the one it belongs to
             std::vector<int> visible;
-            collectVisibleFaces(apex, visible);
-
-            // 2) compute horizon edges
-            auto horizon = computeHorizon(visible);
+            collectVisibleFaces(fi, apex, visible);
 
-            // 3) deactivate visible faces
+            // 2) deactivate visible faces
             for (int vfi : visible) faces[vfi].alive = false;
 
-            // 4) create new faces from horizon edges to apex
-            // ensure outward orientation: for edge (u->v), make face (u, v, apex).
-            // We'll flip later if orientation is incorrect.
-            std::vector<int> newFaces;
-            newFaces.reserve(horizon.size());
-
-            // choose a reference point likely inside hull (average of one active face)
-            Vec3 ref{0,0,0};
-            bool ref_found=false;
-            for (auto& f : faces) if (f.alive) {
-                ref = (pts[f.v[0]] + pts[f.v[1]] + pts[f.v[2]]) * (1.0/3.0);
-                ref_found=true; break;
-            }
-            if (!ref_found) {
-                // fallback: average of apex and any three points
-                ref = pts[apex];
-            }
+            // 3) walk the horizon
+            auto horizon = computeHorizon(visible);
 
-            for (auto [u,v] : horizon) {
-                Face nf;
+            // 4) create new faces (u, v, apex) from horizon edges u->v: the edge keeps the
+            // winding of its visible face, so the new face is already outward. Face k sits
+            // between the horizon face across u->v and new faces k-1 (apex->u) and k+1 (v->apex).
+            // Slots come from the pool, so the new faces' indices are allocated up front.
+            const int k = (int)horizon.size();
+            std::vector<int> newFaces(k);
+            for (int& nf : newFaces) nf = allocFace();
+            const size_t idle = freeFaces.size();
+            std::vector<int> ringStart(visible.size(), -1);
+
+            for (int i = 0; i < k; ++i) {
+                auto [u, v, from, across] = horizon[i];
+                if (ringStart[from] < 0) ringStart[from] = i;
+
+                Face& nf = faces[newFaces[i]];
                 nf.v = {u, v, apex};
+                nf.nb = {across, newFaces[(i+1) % k], newFaces[(i+k-1) % k]};
                 nf.plane = planeFrom(pts[u], pts[v], pts[apex]);
-                nf.alive = true;
-                // flip if not outward relative to ref (ref should be inside -> negative side)
-                if (nf.plane.signedDistance(ref) > 0) {
-                    std::swap(nf.v[0], nf.v[1]);
-                    nf.plane = planeFrom(pts[nf.v[0]], pts[nf.v[1]], pts[nf.v[2]]);
-                }
-                newFaces.push_back((int)faces.size());
-                faces.push_back(std::move(nf));
+                faces[across].nb[edgeStartingAt(across, v)] = newFaces[i];
             }
 
             // 5) reassign outside points of removed faces to new faces
-            reassignOutsidePoints(visible, newFaces);
+            reassignOutsidePoints(apex, visible, newFaces, ringStart);
+            for (int nf : newFaces) queueFace(nf);
+
+            // 6) recycle the visible faces' slots; compact when too many were not even
+            // needed for this step's new faces
+            for (int vfi : visible) freeFaces.push_back(vfi);
+            if (idle > compactMinFree) compactFaces();
+        }
+    }
+
+    int QuickHull3D::allocFace() {
+        if (freeFaces.empty()) {
+            faces.emplace_back();
+            return (int)faces.size() - 1;
         }
+        int f = freeFaces.back();
+        freeFaces.pop_back();
+        unsigned gen = faces[f].gen + 1;
+        faces[f] = Face{};
+        faces[f].gen = gen;
+        return f;
+    }
+
+    void QuickHull3D::compactFaces() {
+        std::vector<int> newIndex(faces.size(), -1);
+        int live = 0;
+        for (size_t i = 0; i < faces.size(); ++i)
+            if (faces[i].alive) newIndex[i] = live++;
+
+        std::vector<Face> packed;
+        packed.reserve(live);
+        for (auto& f : faces) {
+            if (!f.alive) continue;
+            for (int& g : f.nb) g = newIndex[g];
+            packed.push_back(std::move(f));
+        }
+        faces.swap(packed);
+        freeFaces.clear();
+
+        // every queued index moved: requeue the faces that still have work
+        faceQueue = {};
+        for (int f = 0; f < live; ++f) queueFace(f);
     }
 
 } // namespace qh3d
@@ -0,0 +1,76 @@
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include "point.h"
+#include "radix_sort.h"
+
+// Buckets smaller than this are finished with std::sort
+static const size_t RADIX_LEAF = 48;
+
+static inline bool lessXY(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+// digit 0..7 are the bytes of the x key from the top, 8..15 those of the y key
+static inline unsigned digitOf(const Point& p, int d) {
+    uint64_t key = d < 8 ? orderedKey(p.x) : orderedKey(p.y);
+    return (key >> (8 * (7 - d % 8))) & 0xff;
+}
+
+static void radixSortInto(Point* in, Point* out, size_t n, int d);
+
+// Sort data[0, n) in place, tmp is scratch of the same size
+static void radixSortInPlace(Point* data, Point* tmp, size_t n, int d) {
+    // skip digits on which every point agrees (sign and exponent bytes usually do)
+    while (n > RADIX_LEAF && d < 16) {
+        size_t count[256] = {};
+        for (size_t i = 0; i < n; i++) count[digitOf(data[i], d)]++;
+        if (count[digitOf(data[0], d)] == n) { d++; continue; }
+
+        size_t offset[256], sum = 0;
+        for (int v = 0; v < 256; v++) { offset[v] = sum; sum += count[v]; }
+        for (size_t i = 0; i < n; i++) tmp[offset[digitOf(data[i], d)]++] = data[i];
+
+        // each bucket goes back from tmp into data
+        size_t lo = 0;
+        for (int v = 0; v < 256; lo += count[v], v++) {
+            if (count[v]) radixSortInto(tmp + lo, data + lo, count[v], d + 1);
+        }
+        return;
+    }
+    std::sort(data, data + n, lessXY);
+}
+
+// Sort the contents of in[0, n) into out[0, n); `in` is used as scratch
+static void radixSortInto(Point* in, Point* out, size_t n, int d) {
+    while (n > RADIX_LEAF && d < 16) {
+        size_t count[256] = {};
+        for (size_t i = 0; i < n; i++) count[digitOf(in[i], d)]++;
+        if (count[digitOf(in[0], d)] == n) { d++; continue; }
+
+        size_t offset[256], sum = 0;
+        for (int v = 0; v < 256; v++) { offset[v] = sum; sum += count[v]; }
+        for (size_t i = 0; i < n; i++) out[offset[digitOf(in[i], d)]++] = in[i];
+
+        size_t lo = 0;
+        for (int v = 0; v < 256; lo += count[v], v++) {
+            if (count[v]) radixSortInPlace(out + lo, in + lo, count[v], d + 1);
+        }
+        return;
+    }
+    std::copy(in, in + n, out);
+    std::sort(out, out + n, lessXY);
+}
+
+// Radix sort on (x, y)
+void radixSortPoints(std::vector<Point>& pts, std::vector<Point>& scratch) {
+    if (pts.size() < 2) return;
+    scratch.resize(pts.size());
+    radixSortInPlace(pts.data(), scratch.data(), pts.size(), 0);
+}
+
+void radixSortPoints(Point* pts, Point* scratch, size_t n) {
+    if (n < 2) return;
+    radixSortInPlace(pts, scratch, n, 0);
+}
@@ -0,0 +1,179 @@
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "point.h"
+#include "point_view.h"
+#include "quick_hull.h"
+#include "quick_hull_3d.h"
+#include "sharded_hull.h"
+
+// Shared segment: one survivor count per shard, then each shard's index slots. A shard
+// gets as many slots as it has points; tmpfs only backs the pages children write.
+class ShardSegment {
+public:
+    ShardSegment(size_t n, size_t shards) : shards(shards) {
+        static std::atomic<unsigned> serial{0};
+        std::string name = "/convexhull-" + std::to_string(getpid()) + "-" + std::to_string(serial++);
+        int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0) throw std::runtime_error("shm_open: " + std::string(std::strerror(errno)));
+        shm_unlink(name.c_str());       // the mapping below keeps it alive
+
+        bytes = shards * sizeof(uint64_t) + n * sizeof(uint32_t);
+        if (ftruncate(fd, bytes) != 0) {
+            int err = errno;
+            ::close(fd);
+            throw std::runtime_error("ftruncate: " + std::string(std::strerror(err)));
+        }
+        base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int err = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) throw std::runtime_error("mmap: " + std::string(std::strerror(err)));
+    }
+    ~ShardSegment() { munmap(base, bytes); }
+    ShardSegment(const ShardSegment&) = delete;
+    ShardSegment& operator=(const ShardSegment&) = delete;
+
+    uint64_t* counts() { return static_cast<uint64_t*>(base); }
+    uint32_t* slots(size_t first) { return reinterpret_cast<uint32_t*>(counts() + shards) + first; }
+
+private:
+    size_t shards;
+    size_t bytes = 0;
+    void* base = nullptr;
+};
+
+// Fork one child per shard [first, last) of n; each runs work(first, last, out), which
+// writes the global indices of its survivors to out and returns how many. Returns all
+// survivors in increasing index order.
+template <class Work>
+static std::vector<uint32_t> forkShards(size_t n, size_t shards, Work work) {
+    ShardSegment segment(n, shards);
+    auto bound = [&](size_t s) { return n * s / shards; };
+
+    std::vector<pid_t> children;
+    for (size_t s = 0; s < shards; s++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            // child: never return into the caller's stack, never run its destructors
+            int status = 0;
+            try {
+                segment.counts()[s] = work(bound(s), bound(s + 1), segment.slots(bound(s)));
+            } catch (...) {
+                status = 1;
+            }
+            _exit(status);
+        }
+        if (pid < 0) {
+            int err = errno;
+            for (pid_t c : children) waitpid(c, nullptr, 0);
+            throw std::runtime_error("fork: " + std::string(std::strerror(err)));
+        }
+        children.push_back(pid);
+    }
+
+    bool failed = false;
+    for (pid_t c : children) {
+        int status = 0;
+        while (waitpid(c, &status, 0) < 0 && errno == EINTR) {}
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+    }
+    if (failed) throw std::runtime_error("sharded hull worker failed");
+
+    std::vector<uint32_t> survivors;
+    for (size_t s = 0; s < shards; s++) {
+        const uint32_t* idx = segment.slots(bound(s));
+        survivors.insert(survivors.end(), idx, idx + segment.counts()[s]);
+    }
+    std::sort(survivors.begin(), survivors.end());
+    return survivors;
+}
+
+// Inputs past `maxPoints` cannot be indexed through the shared segment and stay in-process
+static size_t shardCount(size_t n, unsigned processes, size_t cutoff, size_t maxPoints) {
+    size_t p = processes ? processes : std::max(1u, std::thread::hardware_concurrency());
+    if (n > maxPoints) return 1;
+    return std::max<size_t>(1, std::min(p, n / std::max<size_t>(cutoff, 1)));
+}
+
+// Views over part of a view
+static PointView subView(const PointView& in, size_t first, size_t last) {
+    auto at = [&](const double* base) {
+        return reinterpret_cast<const double*>(reinterpret_cast<const char*>(base) + first * in.stride);
+    };
+    return pointStrided(at(in.x), at(in.y), last - first, in.stride);
+}
+
+static qh3d::PointView3D subView(const qh3d::PointView3D& in, size_t first, size_t last) {
+    auto at = [&](const double* base) {
+        return reinterpret_cast<const double*>(reinterpret_cast<const char*>(base) + first * in.stride);
+    };
+    return {at(in.x), at(in.y), at(in.z), last - first, in.stride};
+}
+
+// Survivors come back in input order, so quickHull on them sees the same leftmost and
+// rightmost points first and picks the same pivots as on the whole input
+std::vector<Point> shardedHull(const PointView& in, unsigned processes, size_t cutoff) {
+    std::vector<Point> pts;
+    size_t shards = shardCount(in.size(), processes, cutoff, UINT32_MAX);
+    if (shards == 1) {
+        pts.reserve(in.size());
+        for (size_t i = 0; i < in.size(); i++) pts.push_back(in[i]);
+        return quickHull(std::move(pts));
+    }
+
+    auto survivors = forkShards(in.size(), shards, [&](size_t first, size_t last, uint32_t* out) {
+        auto hull = quickHullIndices(subView(in, first, last));
+        for (size_t i = 0; i < hull.size(); i++) out[i] = (uint32_t)(first + hull[i]);
+        return hull.size();
+    });
+
+    pts.reserve(survivors.size());
+    for (uint32_t i : survivors) pts.push_back(in[i]);
+    return quickHull(std::move(pts));
+}
+
+std::vector<std::array<int,3>> shardedHull3D(const qh3d::PointView3D& in, unsigned processes,
+                                             double eps, size_t cutoff) {
+    // faces hold int indices
+    if (in.size() > (size_t)INT_MAX) throw std::length_error("shardedHull3D: more than 2^31 - 1 points");
+    size_t shards = shardCount(in.size(), processes, cutoff, INT_MAX);
+    if (shards == 1) return qh3d::convex_hull_3d(in, eps);
+
+    auto survivors = forkShards(in.size(), shards, [&](size_t first, size_t last, uint32_t* out) {
+        std::vector<std::array<int,3>> faces;
+        try {
+            faces = qh3d::convex_hull_3d(subView(in, first, last), eps);
+        } catch (const std::runtime_error&) {
+            // collinear / coplanar shard: no hull to reduce it to
+        }
+        size_t count = 0;
+        if (faces.empty()) {
+            for (size_t i = first; i < last; i++) out[count++] = (uint32_t)i;
+            return count;
+        }
+        std::vector<char> seen(last - first, 0);
+        for (auto& f : faces)
+            for (int v : f)
+                if (!seen[v]) { seen[v] = 1; out[count++] = (uint32_t)(first + v); }
+        return count;
+    });
+
+    std::vector<qh3d::Vec3> pts;
+    pts.reserve(survivors.size());
+    for (uint32_t i : survivors) pts.push_back(in[i]);
+    auto faces = qh3d::convex_hull_3d(pts, eps);
+    for (auto& f : faces)
+        for (int& v : f) v = (int)survivors[v];
+    return faces;
+}
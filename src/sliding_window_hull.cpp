@@ -0,0 +1,74 @@
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include "point.h"
+#include "predicates.h"
+#include "sliding_window_hull.h"
+
+static inline bool lexLess(const Point& a, const Point& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+}
+
+static inline bool samePoint(const Point& a, const Point& b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+void SlidingWindowHull2D::push(double t, const Point& p) {
+    advance(t);
+    if (cacheValid && !cacheCovers(p)) cacheValid = false;
+    points.push_back({t, p});
+    dynamic.insert(p);
+}
+
+void SlidingWindowHull2D::advance(double now) {
+    while (!points.empty() && points.front().t <= now - window) {
+        const Point& p = points.front().p;
+        if (cacheValid && cacheHasVertex(p)) cacheValid = false;
+        dynamic.erase(p);
+        points.pop_front();
+    }
+}
+
+const std::vector<Point>& SlidingWindowHull2D::hull() {
+    if (!cacheValid) refreshCache();
+    return cached;
+}
+
+void SlidingWindowHull2D::refreshCache() {
+    cached = dynamic.hull();
+    cachedRight = std::max_element(cached.begin(), cached.end(), lexLess) - cached.begin();
+    cacheValid = true;
+}
+
+// The cached hull is grahamHull order: the lower chain [0, cachedRight] increases
+// lexicographically and the upper chain [cachedRight, end) + [0] decreases, so either
+// chain can be binary searched for the edge that spans p.
+bool SlidingWindowHull2D::cacheCovers(const Point& p) const {
+    const size_t h = cached.size();
+    if (h < 3) return false;
+    if (lexLess(p, cached[0]) || lexLess(cached[cachedRight], p)) return false;
+
+    // lower chain: first vertex not smaller than p, and the edge ending there
+    auto lowerBegin = cached.begin(), lowerEnd = cached.begin() + cachedRight + 1;
+    auto next = std::lower_bound(lowerBegin, lowerEnd, p, lexLess);
+    if (next != lowerBegin && orientation(*std::prev(next), p, *next) > 0) return false;
+
+    // upper chain, walked in decreasing order
+    auto upperLess = [](const Point& a, const Point& b) { return lexLess(b, a); };
+    auto upperBegin = cached.begin() + cachedRight, upperEnd = cached.end();
+    auto it = std::lower_bound(upperBegin, upperEnd, p, upperLess);
+    const Point& to = (it == upperEnd) ? cached[0] : *it;
+    if (it != upperBegin && orientation(*std::prev(it), p, to) > 0) return false;
+    return true;
+}
+
+bool SlidingWindowHull2D::cacheHasVertex(const Point& p) const {
+    auto lowerEnd = cached.begin() + std::min(cached.size(), cachedRight + 1);
+    auto it = std::lower_bound(cached.begin(), lowerEnd, p, lexLess);
+    if (it != lowerEnd && samePoint(*it, p)) return true;
+
+    auto upperLess = [](const Point& a, const Point& b) { return lexLess(b, a); };
+    auto upperBegin = cached.begin() + std::min(cached.size(), cachedRight);
+    it = std::lower_bound(upperBegin, cached.end(), p, upperLess);
+    return it != cached.end() && samePoint(*it, p);
+}
@@ -0,0 +1,28 @@
+#ifndef HULL_TEST_UTIL_H
+#define HULL_TEST_UTIL_H
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "point.h"
+
+// Exact, ordered comparison of a hull against the expected one: same vertices in the
+// same order, bit for bit. `count` vertices of `got`, for engines that fill a buffer.
+inline void expectSameHull(const Point* got, size_t count, const std::vector<Point>& expected) {
+    ASSERT_EQ(count, expected.size());
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(got[i].x, expected[i].x);
+        EXPECT_EQ(got[i].y, expected[i].y);
+    }
+}
+
+inline void expectSameHull(const std::vector<Point>& got, const std::vector<Point>& expected) {
+    expectSameHull(got.data(), got.size(), expected);
+}
+
+// A file name under the test temp directory
+inline std::string tempPath(const char* name) {
+    return ::testing::TempDir() + name;
+}
+
+#endif
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "batch_hull.h"
+#include "graham_hull.h"
+
+// Helper: every group's hull must equal grahamHull on that group
+static void expectSameHulls(const std::vector<Point>& pts, const std::vector<uint32_t>& offsets,
+                            const HullBatch& batch) {
+    ASSERT_EQ(batch.offsets.size(), offsets.size());
+    ASSERT_EQ(batch.offsets.back(), batch.indices.size());
+    for (size_t g = 0; g + 1 < offsets.size(); g++) {
+        std::vector<Point> group(pts.begin() + offsets[g], pts.begin() + offsets[g+1]);
+        auto expected = grahamHull(group);
+        ASSERT_EQ(batch.offsets[g+1] - batch.offsets[g], expected.size()) << "group " << g;
+        for (size_t i = 0; i < expected.size(); i++) {
+            uint32_t idx = batch.indices[batch.offsets[g] + i];
+            EXPECT_GE(idx, offsets[g]);
+            EXPECT_LT(idx, offsets[g+1]);
+            EXPECT_EQ(pts[idx].x, expected[i].x);
+            EXPECT_EQ(pts[idx].y, expected[i].y);
+        }
+    }
+}
+
+TEST(BatchHullTest, SmallGroups) {
+    std::vector<Point> pts = {
+        {0,0}, {1,0}, {0,1}, {0.2,0.2},     // triangle with an interior point
+        {5,5},                              // single point
+        {0,0}, {1,1}, {2,2}                 // collinear
+    };
+    std::vector<uint32_t> offsets = {0, 4, 5, 5, 8};   // includes an empty group
+    auto batch = batchHulls(pts, offsets);
+    EXPECT_EQ(batch.offsets, (std::vector<uint32_t>{0, 3, 4, 4, 6}));
+    expectSameHulls(pts, offsets, batch);
+}
+
+TEST(BatchHullTest, ManyRandomGroupsAcrossThreads) {
+    std::mt19937 rng(53);
+    std::uniform_int_distribution<int> size(0, 200);
+    std::uniform_int_distribution<int> grid(0, 20);
+    std::vector<Point> pts;
+    std::vector<uint32_t> offsets = {0};
+    for (int g = 0; g < 3000; g++) {
+        int n = size(rng);
+        for (int i = 0; i < n; i++) pts.push_back({(double)grid(rng), (double)grid(rng)});
+        offsets.push_back(pts.size());
+    }
+
+    auto serial = batchHulls(pts, offsets, 1);
+    auto parallel = batchHulls(pts, offsets, 8);
+    expectSameHulls(pts, offsets, serial);
+    EXPECT_EQ(parallel.offsets, serial.offsets);
+    EXPECT_EQ(parallel.indices, serial.indices);
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <cmath>
+#include "chan_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+TEST(ChanHullTest, SquareCase) {
+    std::vector<Point> pts = {
+        {0,0}, {0,1}, {1,0}, {1,1}, {0.5,0.5}
+    };
+    auto hull = chanHull(pts);
+    EXPECT_EQ(hull.size(), 4);
+    expectSameHull(chanHull(pts), grahamHull(pts));
+}
+
+TEST(ChanHullTest, CollinearCase) {
+    std::vector<Point> pts = { {0,0}, {1,1}, {2,2}, {3,3} };
+    expectSameHull(chanHull(pts), grahamHull(pts));
+}
+
+TEST(ChanHullTest, TangentOnPolygon) {
+    std::vector<Point> poly = { {0,0}, {2,0}, {3,1}, {2,2}, {0,2}, {-1,1} };
+    // From below-right the march wraps to the rightmost vertex
+    EXPECT_EQ(chanTangent(poly, {3,-2}), 2u);
+    // From a vertex it continues with the next one
+    EXPECT_EQ(chanTangent(poly, {2,0}), 2u);
+}
+
+TEST(ChanHullTest, RandomCloudMatchesGraham) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(100000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    expectSameHull(chanHull(pts), grahamHull(pts));
+}
+
+TEST(ChanHullTest, IntegerGridWithDuplicates) {
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> coord(0, 20);
+    std::vector<Point> pts(5000);
+    for (auto& p : pts) p = {(double)coord(rng), (double)coord(rng)};
+    expectSameHull(chanHull(pts), grahamHull(pts));
+}
+
+TEST(ChanHullTest, PointsOnCircle) {
+    std::vector<Point> pts;
+    for (int i = 0; i < 3000; i++)
+        pts.push_back({std::cos(i * 0.002), std::sin(i * 0.002)});
+    expectSameHull(chanHull(pts), grahamHull(pts));
+}
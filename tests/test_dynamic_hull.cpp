@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <algorithm>
+#include "dynamic_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+TEST(DynamicHullTest, SquareCase) {
+    DynamicHull2D dyn;
+    std::vector<Point> pts = {{0,0}, {0,1}, {1,0}, {1,1}, {0.5,0.5}, {2,0.5}};
+    for (auto& p : pts) dyn.insert(p);
+    EXPECT_EQ(dyn.hull().size(), 5);
+
+    EXPECT_TRUE(dyn.erase({2,0.5}));
+    EXPECT_FALSE(dyn.erase({2,0.5}));
+    EXPECT_EQ(dyn.size(), 5);
+    EXPECT_EQ(dyn.hull().size(), 4);
+}
+
+TEST(DynamicHullTest, MixedUpdatesMatchGraham) {
+    std::mt19937 rng(37);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    DynamicHull2D dyn;
+    std::vector<Point> pts;
+    for (int step = 0; step < 6000; step++) {
+        if (pts.size() > 2 && rng() % 3 == 0) {
+            // erase a random point, hull vertices included
+            size_t i = rng() % pts.size();
+            EXPECT_TRUE(dyn.erase(pts[i]));
+            pts[i] = pts.back();
+            pts.pop_back();
+        } else {
+            pts.push_back({coord(rng), coord(rng)});
+            dyn.insert(pts.back());
+        }
+        if (step % 97 == 0 && pts.size() > 2) expectSameHull(dyn.hull(), grahamHull(pts));
+    }
+    expectSameHull(dyn.hull(), grahamHull(pts));
+}
+
+TEST(DynamicHullTest, GridWithDuplicatesMatchesGraham) {
+    // collinear runs, vertical extreme columns and repeated points
+    std::mt19937 rng(41);
+    std::uniform_int_distribution<int> coord(0, 5);
+    DynamicHull2D dyn;
+    std::vector<Point> pts = {{2,2}, {2,3}};
+    for (auto& p : pts) dyn.insert(p);
+    for (int step = 0; step < 2000; step++) {
+        if (pts.size() > 2 && rng() % 2 == 0) {
+            size_t i = 2 + rng() % (pts.size() - 2);
+            EXPECT_TRUE(dyn.erase(pts[i]));
+            pts[i] = pts.back();
+            pts.pop_back();
+        } else {
+            pts.push_back({(double)coord(rng), (double)coord(rng)});
+            dyn.insert(pts.back());
+        }
+        expectSameHull(dyn.hull(), grahamHull(pts));
+    }
+}
+
+TEST(DynamicHullTest, EraseEverything) {
+    std::vector<Point> pts;
+    for (int i = 0; i < 200; i++) pts.push_back({std::cos(i * 0.1), std::sin(i * 0.1)});
+    DynamicHull2D dyn;
+    for (auto& p : pts) dyn.insert(p);
+    expectSameHull(dyn.hull(), grahamHull(pts));
+
+    while (pts.size() > 1) {
+        dyn.erase(pts.back());
+        pts.pop_back();
+    }
+    EXPECT_EQ(dyn.hull().size(), 1);
+    dyn.erase(pts.back());
+    EXPECT_TRUE(dyn.empty());
+    EXPECT_TRUE(dyn.hull().empty());
+}
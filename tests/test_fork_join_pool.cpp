@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include "fork_join_pool.h"
+
+// Recursive fork-join sum of [lo, hi): every level forks one half and joins it
+static long long forkSum(ForkJoinPool& pool, long long lo, long long hi) {
+    if (hi - lo <= 16) {
+        long long s = 0;
+        for (long long i = lo; i < hi; i++) s += i;
+        return s;
+    }
+    long long mid = lo + (hi - lo) / 2, left = 0;
+    ForkJoinPool::Group group;
+    pool.fork(group, [&] { left = forkSum(pool, lo, mid); });
+    long long right = forkSum(pool, mid, hi);
+    pool.join(group);
+    return left + right;
+}
+
+TEST(ForkJoinPoolTest, NestedForksFinishOnABoundedPool) {
+    // thousands of nested tasks on at most 3 threads: joiners run queued tasks
+    // themselves instead of blocking, so nothing deadlocks
+    for (unsigned threads : {1u, 3u}) {
+        ForkJoinPool pool(threads);
+        EXPECT_EQ(pool.size(), threads);
+        EXPECT_EQ(forkSum(pool, 0, 100000), 100000LL * 99999 / 2);
+    }
+}
+
+TEST(ForkJoinPoolTest, ParallelForCoversEveryIndexOnce) {
+    ForkJoinPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i]++; });
+    for (auto& h : hits) EXPECT_EQ(h.load(), 1);
+}
+
+TEST(ForkJoinPoolTest, JoinRethrowsTaskExceptions) {
+    ForkJoinPool pool(2);
+    std::atomic<int> ran{0};
+    EXPECT_THROW(pool.parallelFor(8, [&](size_t i) {
+        ran++;
+        if (i == 5) throw std::runtime_error("task failed");
+    }), std::runtime_error);
+    // every other task still ran before the exception came back
+    EXPECT_EQ(ran.load(), 8);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "graham_hull.h"
+#include "radix_sort.h"
+#include "hull_test_util.h"
+
+TEST(GrahamHullTest, SquareCase) {
+    std::vector<Point> pts = {
+        {0,0}, {0,1}, {1,0}, {1,1}, {0.5,0.5}
+    };
+    auto hull = grahamHull(pts);
+    EXPECT_EQ(hull.size(), 4);
+}
+
+TEST(GrahamHullTest, ParallelMatchesSerial) {
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(200000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+
+    expectSameHull(grahamHullParallel(pts, 8, 1000), grahamHull(pts));
+}
+
+TEST(GrahamHullTest, ParallelMatchesSerialOnGrid) {
+    // many collinear and repeated points across slab boundaries
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> coord(0, 10);
+    std::vector<Point> pts(20000);
+    for (auto& p : pts) p = {(double)coord(rng), (double)coord(rng)};
+
+    expectSameHull(grahamHullParallel(pts, 7, 100), grahamHull(pts));
+}
+
+TEST(GrahamHullTest, RadixSortMatchesStdSort) {
+    std::mt19937 rng(29);
+    std::uniform_real_distribution<double> coord(-1e6, 1e6);
+    std::uniform_int_distribution<int> small(-3, 3);
+    std::vector<Point> pts(50000);
+    for (size_t i = 0; i < pts.size(); i++) {
+        // mix of wide-range values, repeated x values and signed zeros
+        if (i % 3 == 0) pts[i] = {(double)small(rng), coord(rng)};
+        else if (i % 3 == 1) pts[i] = {coord(rng), coord(rng) * 1e-300};
+        else pts[i] = {i % 2 ? -0.0 : 0.0, (double)small(rng)};
+    }
+
+    auto expected = pts;
+    std::sort(expected.begin(), expected.end(), [](const Point &a, const Point &b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+    });
+    std::vector<Point> scratch;
+    radixSortPoints(pts, scratch);
+
+    ASSERT_EQ(pts.size(), expected.size());
+    for (size_t i = 0; i < pts.size(); i++) {
+        EXPECT_EQ(pts[i].x, expected[i].x);
+        EXPECT_EQ(pts[i].y, expected[i].y);
+    }
+}
+
+TEST(GrahamHullTest, ParallelMatchesSerialWithSkewedSlabs) {
+    // most points on one spot: the sample splitters coincide and most slabs stay empty
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(100000, Point{0.25, -0.5});
+    for (size_t i = 0; i < pts.size(); i += 10) pts[i] = {coord(rng), coord(rng)};
+
+    expectSameHull(grahamHullParallel(pts, 8, 1000), grahamHull(pts));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "incremental_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+// The online hull, and its vertex count, against grahamHull of every point so far
+static void expectMatchesGraham(const IncrementalHull2D& inc, const std::vector<Point>& pts) {
+    auto expected = grahamHull(pts);
+    EXPECT_EQ(inc.size(), expected.size());
+    expectSameHull(inc.hull(), expected);
+}
+
+TEST(IncrementalHullTest, SquareCase) {
+    IncrementalHull2D inc;
+    EXPECT_TRUE(inc.insert({0,0}));
+    EXPECT_TRUE(inc.insert({1,1}));
+    EXPECT_TRUE(inc.insert({0,1}));
+    EXPECT_TRUE(inc.insert({1,0}));
+    EXPECT_FALSE(inc.insert({0.5,0.5}));   // interior
+    EXPECT_FALSE(inc.insert({1,0.5}));     // on an edge
+    EXPECT_FALSE(inc.insert({1,1}));       // repeated vertex
+
+    EXPECT_EQ(inc.size(), 4);
+    EXPECT_TRUE(inc.contains({0.25,0.75}));
+    EXPECT_TRUE(inc.contains({0,0.5}));
+    EXPECT_FALSE(inc.contains({1.5,0.5}));
+}
+
+TEST(IncrementalHullTest, RandomStreamMatchesGraham) {
+    std::mt19937 rng(29);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    IncrementalHull2D inc;
+    std::vector<Point> pts;
+    for (int i = 0; i < 20000; i++) {
+        pts.push_back({coord(rng), coord(rng)});
+        inc.insert(pts.back());
+        if (i < 20 || i % 1000 == 0) expectMatchesGraham(inc, pts);
+    }
+    expectMatchesGraham(inc, pts);
+}
+
+TEST(IncrementalHullTest, GridWithDuplicatesMatchesGraham) {
+    // collinear runs, vertical extreme columns and repeated points
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int> coord(0, 6);
+    IncrementalHull2D inc;
+    std::vector<Point> pts = {{3,3}, {3,4}};
+    for (auto& p : pts) inc.insert(p);
+    for (int i = 0; i < 500; i++) {
+        pts.push_back({(double)coord(rng), (double)coord(rng)});
+        inc.insert(pts.back());
+        expectMatchesGraham(inc, pts);
+    }
+}
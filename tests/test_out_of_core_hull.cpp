@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <cstdio>
+#include <stdexcept>
+#include "out_of_core_hull.h"
+#include "point_file.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+TEST(OutOfCoreHullTest, MatchesInMemoryHull) {
+    std::mt19937 rng(11);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Point> pts(200000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    // collinear points on a hull edge split across chunks
+    for (int i = 0; i <= 50; i++) pts.push_back({-10.0 + 0.4 * i, -10.0});
+
+    std::string path = tempPath("ooc.chpt");
+    writePointFile(path, pts);
+    auto expected = grahamHull(pts);
+    for (size_t chunk : {size_t(777), size_t(65536), size_t(1) << 22}) {
+        size_t chunks = 0;
+        expectSameHull(outOfCoreHull(path, chunk, &chunks), expected);
+        EXPECT_EQ(chunks, (pts.size() + chunk - 1) / chunk);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OutOfCoreHullTest, FloatFileAndTinyChunks) {
+    std::vector<float> xy;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    for (int i = 0; i < 500; i++) xy.push_back(coord(rng));
+    std::vector<Point> pts;
+    for (size_t i = 0; i < xy.size(); i += 2) pts.push_back({xy[i], xy[i + 1]});
+
+    std::string path = tempPath("ooc_float.chpt");
+    writePointFile(path, 2, sizeof(float), xy.data(), pts.size());
+    expectSameHull(outOfCoreHull(path, 1), grahamHull(pts));
+    expectSameHull(outOfCoreHull(path, 3), grahamHull(pts));
+    std::remove(path.c_str());
+}
+
+TEST(OutOfCoreHullTest, RejectsBadInput) {
+    EXPECT_THROW(outOfCoreHull(tempPath("missing.chpt")), std::runtime_error);
+
+    std::vector<qh3d::Vec3> pts = {{0,0,0}, {1,0,0}, {0,1,0}, {0,0,1}};
+    std::string path = tempPath("ooc3d.chpt");
+    writePointFile(path, pts);
+    EXPECT_THROW(outOfCoreHull(path), std::runtime_error);
+    std::remove(path.c_str());
+}
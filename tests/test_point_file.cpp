@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <fstream>
+#include <cstdio>
+#include <stdexcept>
+#include "point_file.h"
+#include "quick_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+TEST(PointFileTest, DoubleFileRoundTrip2D) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(5000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+
+    std::string path = tempPath("points2d.chpt");
+    writePointFile(path, pts);
+    MappedPointFile file(path);
+    ASSERT_EQ(file.dim(), 2);
+    ASSERT_EQ(file.size(), pts.size());
+
+    PointView view = file.view2D();
+    for (size_t i = 0; i < pts.size(); i++) {
+        EXPECT_EQ(view[i].x, pts[i].x);
+        EXPECT_EQ(view[i].y, pts[i].y);
+    }
+    EXPECT_EQ(quickHullIndices(view), quickHullIndices(pointSpan(pts)));
+    EXPECT_EQ(grahamHullIndices(view), grahamHullIndices(pointSpan(pts)));
+    std::remove(path.c_str());
+}
+
+TEST(PointFileTest, FloatFileIsWidened3D) {
+    std::vector<float> coords = {0,0,0, 1,0,0, 0,1,0, 0,0,1, 0.25f,0.25f,0.25f};
+    std::string path = tempPath("points3d.chpt");
+    writePointFile(path, 3, sizeof(float), coords.data(), coords.size() / 3);
+
+    MappedPointFile file(path);
+    ASSERT_EQ(file.dim(), 3);
+    ASSERT_EQ(file.scalarBytes(), 4);
+    EXPECT_THROW(file.view2D(), std::runtime_error);
+
+    auto faces = qh3d::convex_hull_3d(file.view3D(), 0.0);
+    EXPECT_EQ(faces.size(), 4);
+    for (auto& f : faces)
+        for (int v : f) EXPECT_LT(v, 4);
+    std::remove(path.c_str());
+}
+
+TEST(PointFileTest, RejectsMalformedFiles) {
+    EXPECT_THROW(MappedPointFile(tempPath("does_not_exist.chpt")), std::runtime_error);
+
+    std::string path = tempPath("bad.chpt");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "definitely not a point file, but long enough";
+    }
+    EXPECT_THROW(MappedPointFile{path}, std::runtime_error);
+
+    // header claiming more records than the file holds
+    std::vector<Point> pts = {{0,0}, {1,0}, {0,1}};
+    writePointFile(path, pts);
+    {
+        std::fstream io(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t count = 1000;
+        io.seekp(offsetof(PointFileHeader, count));
+        io.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    EXPECT_THROW(MappedPointFile{path}, std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include "point_view.h"
+#include "quick_hull.h"
+#include "graham_hull.h"
+#include "quick_hull_3d.h"
+#include "hull_test_util.h"
+
+// A caller-side record with the coordinates buried between other fields
+struct Record {
+    int id;
+    double x;
+    float speed;
+    double y;
+    char tag[12];
+};
+
+static std::vector<Point> randomCloud(size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(n);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    return pts;
+}
+
+TEST(PointViewTest, ViewsSeeTheSamePoints) {
+    auto pts = randomCloud(100, 59);
+    std::vector<Record> recs(pts.size());
+    PointsSoA cols(pts);
+    for (size_t i = 0; i < pts.size(); i++) recs[i] = {(int)i, pts[i].x, 1.0f, pts[i].y, {}};
+
+    PointView span = pointSpan(pts);
+    PointView strided = pointStrided(&recs[0].x, &recs[0].y, recs.size(), sizeof(Record));
+    PointView columns = pointColumns(cols);
+    for (size_t i = 0; i < pts.size(); i++) {
+        for (const PointView& v : {span, strided, columns}) {
+            EXPECT_EQ(v[i].x, pts[i].x);
+            EXPECT_EQ(v[i].y, pts[i].y);
+        }
+    }
+}
+
+TEST(PointViewTest, EnginesMatchVectorVersions) {
+    // one GrahamScratch for every size: the largest takes the radix sort through it
+    GrahamScratch graham;
+    for (size_t n : {0, 1, 2, 3, 10, 5000, 1 << 17}) {
+        auto pts = randomCloud(n, 61 + n);
+        std::vector<Record> recs(n);
+        for (size_t i = 0; i < n; i++) recs[i] = {(int)i, pts[i].x, 0.0f, pts[i].y, {}};
+        PointView view = pointStrided(&recs.data()->x, &recs.data()->y, n, sizeof(Record));
+
+        std::vector<Point> out(n), scratch;
+        expectSameHull(out.data(), quickHull(view, out.data(), out.size(), scratch), quickHull(pts));
+        expectSameHull(out.data(), grahamHull(view, out.data(), out.size(), graham), grahamHull(pts));
+    }
+}
+
+TEST(PointViewTest, ReportsSizeWhenBufferIsTooSmall) {
+    std::vector<Point> pts = {{0,0}, {1,0}, {1,1}, {0,1}, {0.5,0.5}};
+    std::vector<Point> out(2), scratch;
+    GrahamScratch graham;
+    EXPECT_EQ(quickHull(pointSpan(pts), out.data(), out.size(), scratch), 4);
+    EXPECT_EQ(grahamHull(pointSpan(pts), out.data(), out.size(), graham), 4);
+}
+
+TEST(PointViewTest, ColumnsIn3D) {
+    std::vector<qh3d::Vec3> pts = {
+        {0,0,0}, {1,0,0}, {1,1,0}, {0,1,0},
+        {0,0,1}, {1,0,1}, {1,1,1}, {0,1,1}, {0.5,0.5,0.5}
+    };
+    std::vector<double> x, y, z;
+    for (auto& p : pts) { x.push_back(p.x); y.push_back(p.y); z.push_back(p.z); }
+
+    auto expected = qh3d::convex_hull_3d(pts);
+    std::vector<std::array<int,3>> out(expected.size());
+    size_t count = qh3d::convex_hull_3d(qh3d::pointColumns3D(x.data(), y.data(), z.data(), x.size()),
+                                        out.data(), out.size());
+    ASSERT_EQ(count, expected.size());
+    EXPECT_EQ(out, expected);
+}
+
+TEST(PointViewTest, IndicesMatchPointHulls) {
+    for (unsigned seed = 1; seed <= 5; seed++) {
+        auto pts = randomCloud(2000 * seed, seed);
+        // a grid of duplicates and collinear points as well
+        for (int i = 0; i < 20; i++) pts.push_back({-1.0 + 0.1 * i, -1.0});
+
+        auto q = quickHullIndices(pointSpan(pts));
+        auto g = grahamHullIndices(pointSpan(pts));
+        auto qp = quickHull(pts), gp = grahamHull(pts);
+        ASSERT_EQ(q.size(), qp.size());
+        ASSERT_EQ(g.size(), gp.size());
+        for (size_t i = 0; i < qp.size(); i++) {
+            EXPECT_EQ(pts[q[i]].x, qp[i].x);
+            EXPECT_EQ(pts[q[i]].y, qp[i].y);
+        }
+        for (size_t i = 0; i < gp.size(); i++) {
+            EXPECT_EQ(pts[g[i]].x, gp[i].x);
+            EXPECT_EQ(pts[g[i]].y, gp[i].y);
+        }
+    }
+}
+
+TEST(PointViewTest, DuplicateVertexResolvesToFirstIndex) {
+    std::vector<Point> pts = {{1,1}, {0,0}, {1,0}, {0,0}, {0,1}, {0.5,0.5}};
+    std::vector<uint32_t> expected = {1, 2, 0, 4};
+    EXPECT_EQ(grahamHullIndices(pointSpan(pts)), expected);
+}
+
+TEST(PointViewTest, IndicesRejectViewsPastUint32) {
+    // stride 0 repeats one point, so the view needs no backing storage
+    double x = 0, y = 0;
+    auto huge = pointStrided(&x, &y, (size_t)UINT32_MAX + 1, 0);
+    EXPECT_THROW(quickHullIndices(huge), std::length_error);
+    EXPECT_THROW(grahamHullIndices(huge), std::length_error);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "predicates.h"
+#include "graham_hull.h"
+#include "quick_hull.h"
+
+static int sign(double v) { return (v > 0) - (v < 0); }
+
+// Reference sign for points on the grid k * 2^-53: scaled to integers, cross is exact in 128 bits
+static int exactSign2d(const Point& a, const Point& b, const Point& c) {
+    auto s = [](double v) { return (__int128)std::ldexp(v, 53); };
+    __int128 d = (s(b.x) - s(a.x)) * (s(c.y) - s(a.y)) - (s(b.y) - s(a.y)) * (s(c.x) - s(a.x));
+    return (d > 0) - (d < 0);
+}
+
+TEST(PredicatesTest, Orient2dBasicSigns) {
+    EXPECT_GT(orient2d({0,0}, {1,0}, {0,1}), 0);
+    EXPECT_LT(orient2d({0,0}, {0,1}, {1,0}), 0);
+    EXPECT_EQ(orient2d({0,0}, {1,1}, {3,3}), 0);
+}
+
+TEST(PredicatesTest, Orient2dNearCollinearIsExact) {
+    // the classic failure grid: points a few ulps around (0.5, 0.5) against the line y = x
+    const double u = std::ldexp(1.0, -53);
+    Point b{12, 12}, c{24, 24};
+    for (int i = 0; i < 64; i++) {
+        for (int j = 0; j < 64; j++) {
+            Point a{0.5 + i * u, 0.5 + j * u};
+            EXPECT_EQ(sign(orient2d(a, b, c)), exactSign2d(a, b, c)) << i << "," << j;
+        }
+    }
+}
+
+TEST(PredicatesTest, Orient3dCoplanarIsExact) {
+    // integer points on x + y + z = 2^41: exactly coplanar, but the products overflow 53 bits
+    std::mt19937_64 rng(5);
+    std::uniform_int_distribution<int64_t> coord(-(1LL << 40), 1LL << 40);
+    const double k = std::ldexp(1.0, 41);
+    auto onPlane = [&] { double x = coord(rng), y = coord(rng); return std::array<double,3>{x, y, k - x - y}; };
+    for (int t = 0; t < 200; t++) {
+        auto a = onPlane(), b = onPlane(), c = onPlane(), d = onPlane();
+        EXPECT_EQ(orient3d(a[0], a[1], a[2], b[0], b[1], b[2], c[0], c[1], c[2], d[0], d[1], d[2]), 0);
+
+        // one unit along z moves d to the side the (b-a)×(c-a) normal's z component points to
+        double nz = (b[0]-a[0]) * (c[1]-a[1]) - (b[1]-a[1]) * (c[0]-a[0]);
+        double o = orient3d(a[0], a[1], a[2], b[0], b[1], b[2], c[0], c[1], c[2], d[0], d[1], d[2] + 1);
+        EXPECT_EQ(sign(o), sign(nz));
+    }
+}
+
+TEST(PredicatesTest, Orient3dMatchesPlaneSide) {
+    // (0,0,0), (1,0,0), (0,1,0) has normal +z
+    EXPECT_GT(orient3d(0,0,0, 1,0,0, 0,1,0, 0,0,1), 0);
+    EXPECT_LT(orient3d(0,0,0, 1,0,0, 0,1,0, 0,0,-1), 0);
+}
+
+TEST(PredicatesTest, HullsAreExactlyConvex) {
+    // nearly collinear points: every hull turn must be strictly left and no input point
+    // may lie strictly outside any hull edge, judged by the exact predicate
+    const double u = std::ldexp(1.0, -53);
+    std::vector<Point> pts = {{12, 12}, {24, 24}, {0, 1}};
+    for (int i = 0; i < 16; i++)
+        for (int j = 0; j < 16; j++) pts.push_back({0.5 + i * u, 0.5 + j * u});
+
+    for (auto hull : {grahamHull(pts), quickHull(pts)}) {
+        ASSERT_GE(hull.size(), 3u);
+        size_t h = hull.size();
+        for (size_t i = 0; i < h; i++) {
+            const Point &a = hull[i], &b = hull[(i + 1) % h];
+            EXPECT_GT(exactSign2d(a, b, hull[(i + 2) % h]), 0);
+            for (auto& p : pts) EXPECT_GE(exactSign2d(a, b, p), 0);
+        }
+    }
+}
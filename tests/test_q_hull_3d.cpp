@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <set>
+#include <random>
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
 #include "quick_hull_3d.h"
+#include "predicates.h"
 
 using namespace qh3d;
 
@@ -27,6 +32,32 @@ static bool pointInsideHull(const std::vector<Vec3>& pts,
     return true;
 }
 
+// Helper: the live faces of a finished QuickHull3D form a closed mesh, every
+// neighbour link mutual (edge a->b of f is edge b->a of nb, whose link points back)
+static void expectClosedMesh(const QuickHull3D& qh) {
+    for (int f = 0; f < (int)qh.faces.size(); f++) {
+        const Face& F = qh.faces[f];
+        if (!F.alive) continue;
+        for (int i = 0; i < 3; i++) {
+            int g = F.nb[i];
+            ASSERT_TRUE(g >= 0 && g < (int)qh.faces.size() && qh.faces[g].alive);
+            const Face& G = qh.faces[g];
+            int j = 0;
+            while (j < 3 && G.v[j] != F.v[(i+1)%3]) j++;
+            ASSERT_LT(j, 3);
+            EXPECT_EQ(G.v[(j+1)%3], F.v[i]);
+            EXPECT_EQ(G.nb[j], f);
+        }
+    }
+}
+
+// Helper: F = 2V - 4 for a closed triangulated hull
+static void expectEulerCount(const std::vector<std::array<int,3>>& faces) {
+    std::set<int> verts;
+    for (auto& f : faces) verts.insert(f.begin(), f.end());
+    EXPECT_EQ(faces.size(), 2 * verts.size() - 4);
+}
+
 TEST(QuickHull3D, Tetrahedron) {
     std::vector<Vec3> pts = {
         {0,0,0}, {1,0,0}, {0,1,0}, {0,0,1}
@@ -94,3 +125,186 @@ TEST(QuickHull3D, RandomCluster) {
         EXPECT_TRUE(pointInsideHull(pts, faces, p));
     }
 }
+
+TEST(QuickHull3D, ExactModeIgnoresCoplanarPoints) {
+    // cube corners plus points exactly on its faces and edges: with eps = 0 the
+    // exact predicate keeps every one of them off the outside sets
+    std::vector<Vec3> pts = {
+        {0,0,0}, {1,0,0}, {1,1,0}, {0,1,0},
+        {0,0,1}, {1,0,1}, {1,1,1}, {0,1,1},
+        {0.5,0.5,0}, {0.5,0.5,1}, {0,0.5,0.5}, {1,0.25,0.75}, {0.5,0,0}, {0.5,0.5,0.5}
+    };
+
+    auto faces = convex_hull_3d(pts, 0.0);
+    EXPECT_EQ(faces.size(), 12);
+    for (auto& f : faces)
+        for (int v : f) EXPECT_LT(v, 8);
+    for (auto& p : pts) {
+        EXPECT_TRUE(pointInsideHull(pts, faces, p, 0.0));
+    }
+}
+
+TEST(QuickHull3D, LargeRandomBallIsClosedAndContainsAllPoints) {
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Vec3> pts;
+    while (pts.size() < 20000) {
+        Vec3 p{coord(rng), coord(rng), coord(rng)};
+        if (dot(p, p) <= 1.0) pts.push_back(p);
+    }
+
+    for (double eps : {1e-9, 0.0}) {
+        auto faces = convex_hull_3d(pts, eps);
+        expectEulerCount(faces);
+        for (size_t i = 0; i < pts.size(); i += 7) {
+            EXPECT_TRUE(pointInsideHull(pts, faces, pts[i], 1e-9));
+        }
+    }
+}
+
+TEST(QuickHull3D, LargeVisibleRegionKeepsLinksMutual) {
+    // a prism over a finely divided circle, and a point just above the centre of its
+    // top cap: the cap is triangulated before the point is reached, and then every
+    // cap face (thousands) is visible from it at once
+    const int N = 2000;
+    std::vector<Vec3> pts;
+    for (int i = 0; i < N; i++) {
+        double a = 2 * M_PI * i / N;
+        pts.push_back({std::cos(a), std::sin(a), 1});
+        pts.push_back({std::cos(a), std::sin(a), 0});
+    }
+    pts.push_back({0, 0, 1 + 1e-7});
+
+    for (double eps : {1e-9, 0.0}) {
+        QuickHull3D qh(pts, eps);
+        auto faces = qh.compute();
+        expectClosedMesh(qh);
+        expectEulerCount(faces);
+        // the apex is joined to every top rim vertex
+        size_t apexFaces = 0;
+        for (auto& f : faces) apexFaces += std::count(f.begin(), f.end(), 2 * N);
+        EXPECT_EQ(apexFaces, (size_t)N);
+        for (size_t i = 0; i < pts.size(); i += 7) EXPECT_TRUE(pointInsideHull(pts, faces, pts[i], 1e-9));
+    }
+}
+
+// Helper: brute-force check of an exact (eps = 0) hull against every input point. Each
+// face is a proper triangle whose plane, taken through its vertices, has every point
+// on or below it (orient3d, exact), and the hull is closed with mutual links.
+static void expectExactHull(const std::vector<Vec3>& pts) {
+    QuickHull3D qh(pts, 0.0);
+    auto faces = qh.compute();
+    ASSERT_GE(faces.size(), 4u);
+    expectClosedMesh(qh);
+    expectEulerCount(faces);
+    for (auto& f : faces) {
+        const Vec3 &a = pts[f[0]], &b = pts[f[1]], &c = pts[f[2]];
+        EXPECT_GT(norm(cross(b - a, c - a)), 0.0);
+        for (auto& q : pts)
+            ASSERT_LE(orient3d(a.x, a.y, a.z, b.x, b.y, b.z, c.x, c.y, c.z, q.x, q.y, q.z), 0.0);
+    }
+}
+
+TEST(QuickHull3D, ExactHullOfDegenerateInputsMatchesBruteForce) {
+    // integer grid: every face of the cube holds a coplanar grid, every edge a collinear row
+    std::vector<Vec3> grid;
+    for (int x = 0; x < 10; x++)
+        for (int y = 0; y < 10; y++)
+            for (int z = 0; z < 10; z++) grid.push_back({(double)x, (double)y, (double)z});
+    expectExactHull(grid);
+
+    // integer points exactly on the sphere x^2 + y^2 + z^2 = 25^2: many co-circular
+    // quadruples, so neighbouring faces are often coplanar
+    std::vector<Vec3> sphere;
+    for (int x = -25; x <= 25; x++)
+        for (int y = -25; y <= 25; y++)
+            for (int z = -25; z <= 25; z++)
+                if (x * x + y * y + z * z == 625) sphere.push_back({(double)x, (double)y, (double)z});
+    expectExactHull(sphere);
+
+    // duplicates: random points on the unit sphere, all hull vertices, three times over
+    std::mt19937 rng(23);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Vec3> dup(500);
+    for (auto& p : dup) {
+        Vec3 d{coord(rng), coord(rng), coord(rng)};
+        p = d * (1.0 / norm(d));
+    }
+    size_t once = dup.size();
+    for (int copy = 0; copy < 2; copy++)
+        for (size_t i = 0; i < once; i++) dup.push_back(dup[i]);
+    expectExactHull(dup);
+}
+
+// Helper: faces as a set, each rotated to start at its smallest index (winding kept)
+static std::set<std::array<int,3>> canonicalFaces(const std::vector<std::array<int,3>>& faces) {
+    std::set<std::array<int,3>> out;
+    for (auto f : faces) {
+        std::rotate(f.begin(), std::min_element(f.begin(), f.end()), f.end());
+        out.insert(f);
+    }
+    return out;
+}
+
+TEST(QuickHull3D, ReusedFaceSlotsGiveTheSameHull) {
+    std::mt19937 rng(24);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Vec3> pts;
+    while (pts.size() < 100000) {
+        Vec3 p{coord(rng), coord(rng), coord(rng)};
+        if (dot(p, p) <= 1.0) pts.push_back(p);
+    }
+
+    QuickHull3D qh(pts);
+    auto faces = qh.compute();
+    expectClosedMesh(qh);
+    expectEulerCount(faces);
+    for (size_t i = 0; i < pts.size(); i += 7) EXPECT_TRUE(pointInsideHull(pts, faces, pts[i], 1e-9));
+
+    // slots were recycled (a bumped generation) and the pool stayed near the hull's size
+    // instead of holding every face ever created
+    bool reused = false;
+    for (auto& f : qh.faces) reused |= f.gen > 0;
+    EXPECT_TRUE(reused);
+    EXPECT_LT(qh.faces.size(), 2 * faces.size());
+
+    // baseline: the hull of points in general position is unique, so the reversed input,
+    // processed in another order through other slots, gives the same faces
+    std::vector<Vec3> reversed(pts.rbegin(), pts.rend());
+    auto baseline = convex_hull_3d(reversed);
+    for (auto& f : baseline)
+        for (int& v : f) v = (int)pts.size() - 1 - v;
+    EXPECT_EQ(faces.size(), baseline.size());
+    EXPECT_EQ(canonicalFaces(faces), canonicalFaces(baseline));
+}
+
+TEST(QuickHull3D, CompactedPoolGivesTheSameHull) {
+    std::mt19937 rng(25);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Vec3> pts;
+    while (pts.size() < 100000) {
+        Vec3 p{coord(rng), coord(rng), coord(rng)};
+        if (dot(p, p) <= 1.0) pts.push_back(p);
+    }
+
+    // compactMinFree = 0 compacts after every step that leaves a slot idle (dozens of
+    // times here), which remaps every neighbour link and requeues every pending face
+    QuickHull3D compacted(pts, 1e-9, 0);
+    auto faces = compacted.compute();
+    expectClosedMesh(compacted);
+    expectEulerCount(faces);
+    for (size_t i = 0; i < pts.size(); i += 7) EXPECT_TRUE(pointInsideHull(pts, faces, pts[i], 1e-9));
+
+    // same hull as with the default threshold, which never compacts on this input;
+    // compaction packs the faces into another slot order
+    auto baseline = convex_hull_3d(pts);
+    EXPECT_NE(faces, baseline);
+    EXPECT_EQ(canonicalFaces(faces), canonicalFaces(baseline));
+}
+
+TEST(QuickHull3D, RejectsInputsPastIntIndices) {
+    // stride 0 repeats one point, so the view needs no backing storage
+    double c = 0;
+    PointView3D huge{&c, &c, &c, (size_t)INT_MAX + 1, 0};
+    EXPECT_THROW(convex_hull_3d(huge), std::length_error);
+}
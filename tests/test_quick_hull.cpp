@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
+#include <random>
+#include <algorithm>
 #include "quick_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
 
 // Helper: check if a point exists in hull
 bool contains(const std::vector<Point>& hull, const Point& p) {
@@ -59,3 +63,214 @@ TEST(QuickHullTest, ConcaveCase) {
     EXPECT_TRUE(contains(hull, {0,4}));
 
 }
+
+
+TEST(QuickHullTest, RandomCloudMatchesGraham) {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coord(-100.0, 100.0);
+    std::vector<Point> pts(20000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+
+    auto hull = quickHull(pts);
+    auto expected = grahamHull(pts);
+
+    // Same vertex set as the monotone chain
+    EXPECT_EQ(hull.size(), expected.size());
+    for (auto& p : expected)
+        EXPECT_TRUE(contains(hull, p));
+}
+
+TEST(QuickHullTest, ParallelMatchesSerial) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<Point> pts(100000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    // a few points on the unit circle so the hull has many vertices
+    for (int i = 0; i < 500; i++)
+        pts.push_back({std::cos(i * 0.0125), std::sin(i * 0.0125)});
+
+    auto serial = quickHull(pts);
+    auto parallel = quickHullParallel(pts, 1000);
+
+    expectSameHull(parallel, serial);
+}
+
+TEST(QuickHullTest, ParallelMatchesSerialAcrossThreadCounts) {
+    // integer grid: duplicates, collinear runs and tied extremes in every block
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> coord(-40, 40);
+    std::vector<Point> pts(50000);
+    for (auto& p : pts) p = {(double)coord(rng), (double)coord(rng)};
+    for (int i = 0; i < 300; i++)
+        pts.push_back({60 * std::cos(i * 0.021), 60 * std::sin(i * 0.021)});
+
+    auto serial = quickHull(pts);
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        auto parallel = quickHullParallel(pts, 64, threads);
+        SCOPED_TRACE(threads);
+        expectSameHull(parallel, serial);
+    }
+}
+
+TEST(QuickHullTest, SoAMatchesAoS) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> coord(-50.0, 50.0);
+    std::vector<Point> pts(30001);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+    for (int i = 0; i < 300; i++)
+        pts.push_back({60 * std::cos(i * 0.021), 60 * std::sin(i * 0.021)});
+
+    auto aos = quickHull(pts);
+    const SoaKernelIsa initial = soaKernelIsa();
+    for (SoaKernelIsa isa : {SoaKernelIsa::Scalar, SoaKernelIsa::AVX2, SoaKernelIsa::AVX512}) {
+        if (!setSoaKernelIsa(isa)) continue;
+        auto soa = quickHullSoA(PointsSoA(pts));
+        SCOPED_TRACE((int)isa);
+        expectSameHull(soa, aos);
+    }
+    setSoaKernelIsa(initial);
+}
+
+TEST(QuickHullTest, SoAReusedScratchMatchesFreshBuffers) {
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    PointsSoA scratch;
+    // grows, shrinks (stale points stay in scratch), then grows again
+    for (size_t n : {20000, 500, 3, 60000}) {
+        std::vector<Point> pts(n);
+        for (auto& p : pts) p = {coord(rng), coord(rng)};
+        PointsSoA soa(pts);
+
+        auto fresh = quickHullSoA(soa);
+        auto reused = quickHullSoA(soa, scratch);
+        expectSameHull(reused, fresh);
+    }
+}
+
+// Every size around the vector widths, so both the wide loops and the scalar tails run,
+// under each kernel version the CPU supports; integer coordinates give ties on x and
+// points on the edges
+TEST(QuickHullTest, SoAKernelsMatchScalarLoops) {
+    const SoaKernelIsa initial = soaKernelIsa();
+    for (SoaKernelIsa isa : {SoaKernelIsa::Scalar, SoaKernelIsa::AVX2, SoaKernelIsa::AVX512}) {
+        if (!setSoaKernelIsa(isa)) continue;
+        SCOPED_TRACE((int)isa);
+        std::mt19937 rng(12);
+        std::uniform_int_distribution<int> coord(-4, 4);
+        const Point A{-3, -1}, B{4, 2};
+        for (size_t n = 1; n <= 40; n++) {
+            std::vector<Point> pts(n);
+            for (auto& p : pts) p = {(double)coord(rng), (double)coord(rng)};
+            PointsSoA soa(pts);
+
+            size_t iMin = n, iMax = n;
+            soaExtremesX(soa.x.data(), n, iMin, iMax);
+            auto [lo, hi] = std::minmax_element(pts.begin(), pts.end(),
+                [](const Point& a, const Point& b) { return a.x < b.x; });
+            EXPECT_EQ(iMin, (size_t)(lo - pts.begin()));
+            EXPECT_EQ(iMax, (size_t)(hi - pts.begin()));
+
+            for (double minArea : {0.0, -100.0}) {
+                size_t far = n;
+                double best = minArea;
+                for (size_t i = 0; i < n; i++)
+                    if (cross(A, B, pts[i]) > best) { best = cross(A, B, pts[i]); far = i; }
+                EXPECT_EQ(soaFarthestFromEdge(soa.x.data(), soa.y.data(), n, A, B, minArea), far);
+            }
+
+            std::vector<Point> above, below;
+            for (auto& p : pts) {
+                if (cross(A, B, p) > 0) above.push_back(p);
+                if (cross(B, A, p) > 0) below.push_back(p);
+            }
+            std::vector<double> ox(n), oy(n);
+            size_t nFront = 0, nBack = 0;
+            soaSplitOutside(soa.x.data(), soa.y.data(), n, A, B, 0, B, A, 0,
+                            ox.data(), oy.data(), nFront, nBack);
+            ASSERT_EQ(nFront, above.size());
+            ASSERT_EQ(nBack, below.size());
+            // the front keeps input order; the back fills downwards, one vector at a time
+            std::vector<Point> front, back;
+            for (size_t i = 0; i < nFront; i++) front.push_back({ox[i], oy[i]});
+            expectSameHull(front, above);
+            for (size_t i = n - nBack; i < n; i++) back.push_back({ox[i], oy[i]});
+            auto byXY = [](const Point& a, const Point& b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+            std::sort(back.begin(), back.end(), byXY);
+            std::sort(below.begin(), below.end(), byXY);
+            expectSameHull(back, below);
+        }
+    }
+    setSoaKernelIsa(initial);
+}
+
+TEST(QuickHullTest, AklToussaintPrefilter) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coord(0.0, 1.0);
+    std::vector<Point> pts(50000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+
+    size_t removedQ = 0, removedG = 0;
+    auto q = quickHull(pts, true, &removedQ);
+    auto g = grahamHull(pts, true, &removedG);
+
+    // Uniform square: almost everything is inside the extreme octagon
+    EXPECT_GT(removedQ, pts.size() * 95 / 100);
+    EXPECT_EQ(removedQ, removedG);
+
+    auto expected = grahamHull(pts);
+    expectSameHull(g, expected);
+    expectSameHull(q, expected);
+}
+
+TEST(QuickHullTest, OutputIsCounterClockwise) {
+    std::vector<Point> pts;
+    for (int i = 0; i < 2000; i++)
+        pts.push_back({std::cos(i * 0.00314), std::sin(i * 0.00314)});
+    std::mt19937 rng(13);
+    std::shuffle(pts.begin(), pts.end(), rng);
+
+    auto hull = quickHull(pts);
+    ASSERT_EQ(hull.size(), pts.size());
+    expectSameHull(hull, grahamHull(pts));
+    for (size_t i = 0; i < hull.size(); i++) {
+        const Point& a = hull[i];
+        const Point& b = hull[(i + 1) % hull.size()];
+        const Point& c = hull[(i + 2) % hull.size()];
+        EXPECT_GT(cross(a, b, c), 0);
+    }
+}
+
+TEST(QuickHullTest, IntegerKernelIsExact) {
+    // Large integer coordinates whose cross products overflow 64 bits
+    const int64_t big = int64_t(1) << 40;
+    std::vector<PointI> pts = {
+        {-big, -big}, {big, -big}, {big, big}, {-big, big},
+        {big - 1, 0}, {0, big - 1}, {0, big}, {0, 0}
+    };
+
+    auto q = quickHull(pts);
+    auto g = grahamHull(pts);
+
+    // (0, big) lies exactly on the top edge and (0, big - 1) just below it
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(g.size(), 4);
+}
+
+TEST(QuickHullTest, FloatKernelMatchesDouble) {
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<int> coord(-1000, 1000);
+    std::vector<Point> pts(5000);
+    std::vector<PointF> ptsF(pts.size());
+    for (size_t i = 0; i < pts.size(); i++) {
+        pts[i] = {(double)coord(rng), (double)coord(rng)};
+        ptsF[i] = {(float)pts[i].x, (float)pts[i].y};
+    }
+
+    auto hd = quickHull(pts);
+    auto hf = quickHull(ptsF);
+    ASSERT_EQ(hd.size(), hf.size());
+    for (size_t i = 0; i < hd.size(); i++) {
+        EXPECT_EQ(hd[i].x, hf[i].x);
+        EXPECT_EQ(hd[i].y, hf[i].y);
+    }
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <climits>
+#include <stdexcept>
+#include "sharded_hull.h"
+#include "quick_hull.h"
+#include "quick_hull_3d.h"
+#include "hull_test_util.h"
+
+static std::set<int> vertexSet(const std::vector<std::array<int,3>>& faces) {
+    std::set<int> v;
+    for (auto& f : faces) v.insert(f.begin(), f.end());
+    return v;
+}
+
+TEST(ShardedHullTest, MatchesQuickHull2D) {
+    std::mt19937 rng(17);
+    std::normal_distribution<double> coord(0.0, 1.0);
+    std::vector<Point> pts(100000);
+    for (auto& p : pts) p = {coord(rng), coord(rng)};
+
+    auto expected = quickHull(pts);
+    for (unsigned procs : {1u, 3u, 8u}) {
+        expectSameHull(shardedHull(pointSpan(pts), procs, 1000), expected);
+    }
+}
+
+TEST(ShardedHullTest, MatchesQuickHull3D) {
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::vector<qh3d::Vec3> pts(20000);
+    for (auto& p : pts) p = {coord(rng), coord(rng), coord(rng)};
+
+    auto expected = vertexSet(qh3d::convex_hull_3d(pts, 0.0));
+    auto faces = shardedHull3D(pts, 4, 0.0, 1000);
+    EXPECT_EQ(vertexSet(faces), expected);
+    // Euler: a triangulated convex polyhedron with V vertices has 2V - 4 faces
+    EXPECT_EQ(faces.size(), 2 * expected.size() - 4);
+}
+
+TEST(ShardedHullTest, DegenerateShardPublishesAllPoints) {
+    // the first shard is coplanar (z = 0), the second lifts the hull off the plane
+    std::vector<qh3d::Vec3> pts;
+    for (int i = 0; i < 8; i++) pts.push_back({double(i % 3), double(i / 3), 0.0});
+    pts.push_back({0.5, 0.5, 1.0});
+    for (int i = 0; i < 7; i++) pts.push_back({1.0, 1.0, 0.1 * i});
+
+    auto expected = vertexSet(qh3d::convex_hull_3d(pts, 0.0));
+    EXPECT_EQ(vertexSet(shardedHull3D(pts, 2, 0.0, 1)), expected);
+}
+
+TEST(ShardedHullTest, RejectsInputsPastIntFaceIndices3D) {
+    // stride 0 repeats one point, so the view needs no backing storage
+    double c = 0;
+    qh3d::PointView3D huge{&c, &c, &c, (size_t)INT_MAX + 1, 0};
+    EXPECT_THROW(shardedHull3D(huge), std::length_error);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <deque>
+#include "sliding_window_hull.h"
+#include "graham_hull.h"
+#include "hull_test_util.h"
+
+struct Sample {
+    double t;
+    Point p;
+};
+
+// Helper: the window hull must equal grahamHull over the samples still in the window
+static void expectSameHull(SlidingWindowHull2D& win, const std::deque<Sample>& live) {
+    std::vector<Point> pts;
+    for (auto& s : live) pts.push_back(s.p);
+    ASSERT_EQ(win.size(), live.size());
+    expectSameHull(win.hull(), grahamHull(pts));
+}
+
+TEST(SlidingWindowHullTest, EvictsOldPoints) {
+    SlidingWindowHull2D win(10.0);
+    win.push(0, {0,0});
+    win.push(1, {4,0});
+    win.push(2, {0,4});
+    win.push(3, {1,1});
+    EXPECT_EQ(win.hull().size(), 3);
+
+    win.advance(10.5);      // (0,0) drops out
+    EXPECT_EQ(win.size(), 3);
+    EXPECT_EQ(win.hull().size(), 3);
+    EXPECT_EQ(win.hull()[0].x, 0);
+    EXPECT_EQ(win.hull()[0].y, 4);
+
+    win.advance(100);
+    EXPECT_TRUE(win.empty());
+    EXPECT_TRUE(win.hull().empty());
+}
+
+TEST(SlidingWindowHullTest, RandomWalkMatchesGraham) {
+    // a vehicle drifting around: the hull keeps changing as old extremes expire
+    std::mt19937 rng(43);
+    std::normal_distribution<double> step(0.0, 0.1);
+    const double window = 5.0;
+    SlidingWindowHull2D win(window);
+    std::deque<Sample> live;
+    Point pos{0, 0};
+    for (int i = 0; i < 20000; i++) {
+        double t = i * 0.01;
+        pos = {pos.x + step(rng), pos.y + step(rng)};
+        win.push(t, pos);
+        live.push_back({t, pos});
+        while (live.front().t <= t - window) live.pop_front();
+        if (i % 37 == 0) expectSameHull(win, live);
+    }
+}
+
+TEST(SlidingWindowHullTest, GridWithDuplicatesMatchesGraham) {
+    std::mt19937 rng(47);
+    std::uniform_int_distribution<int> coord(0, 4);
+    SlidingWindowHull2D win(30.0);
+    std::deque<Sample> live;
+    for (int i = 0; i < 3000; i++) {
+        Point p{(double)coord(rng), (double)coord(rng)};
+        win.push(i, p);
+        live.push_back({(double)i, p});
+        while (live.front().t <= i - 30.0) live.pop_front();
+
+        bool allSame = true;
+        for (auto& s : live) allSame = allSame && s.p.x == p.x && s.p.y == p.y;
+        if (!allSame) expectSameHull(win, live);
+    }
+}